@@ -0,0 +1,202 @@
+#pragma once // Pipe / Sem 서버가 함께 쓰는 비동기 로거 (safePrint 대체)
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include "futex.hpp"
+
+// 로그 레벨 (BR31_LOG_LEVEL=debug|info|warn|error, 기본 info)
+enum class LogLevel : uint16_t { Debug = 0, Info = 1, Warn = 2, Error = 3 };
+
+// 출력 형식 (BR31_LOG_FORMAT=text|binary, 기본 text)
+// binary : LogFrame 헤더 + 본문 len 바이트를 이어 붙인 스트림 (개행 없음)
+struct LogFrame {
+    uint64_t ts_ns; // CLOCK_REALTIME 나노초
+    uint16_t level; // LogLevel
+    uint16_t len;   // 뒤따르는 본문 바이트 수
+    uint32_t reserved;
+};
+
+#define LOG_TEXT_MAX 240   // 레코드 하나의 최대 본문 길이 (넘치면 잘림)
+#define LOG_QUEUE_SIZE 4096 // 2의 거듭제곱, 가득 차면 생산자는 대기하지 않고 버림
+
+// [ SRP ] 로그 레코드 수집/출력 전담
+// 생산자 : 스레드별 버퍼에 포맷 -> 미리 할당된 링 슬롯을 CAS로 확보해 복사 (힙 할당 / 락 / 시스템 콜 없음)
+// 소비자 : 백그라운드 스레드 하나가 모아서 write() 한 번에 배치 출력
+class AsyncLogger {
+    struct Cell {
+        std::atomic<uint64_t> seq;
+        uint64_t ts_ns;
+        LogLevel level;
+        uint16_t len;
+        char text[LOG_TEXT_MAX];
+    };
+
+    Cell cells[LOG_QUEUE_SIZE];
+    alignas(64) std::atomic<uint64_t> enqueuePos{0};
+    alignas(64) uint64_t dequeuePos = 0;             // 소비자 스레드 전용
+    alignas(64) std::atomic<uint32_t> consumerIdle{0}; // 1 -> 소비자가 futex 대기 중
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<bool> running{false};
+    pthread_t worker{};
+    LogLevel minLevel = LogLevel::Info;
+    bool binary = false;
+    int fd = STDOUT_FILENO;
+    char out[64 * 1024]; // 소비자 배치 출력 버퍼
+
+    AsyncLogger() {
+        for (uint64_t i = 0; i < LOG_QUEUE_SIZE; ++i) cells[i].seq.store(i, std::memory_order_relaxed);
+
+        const char* lv = getenv("BR31_LOG_LEVEL");
+        if (lv != nullptr) {
+            if (strcmp(lv, "debug") == 0) minLevel = LogLevel::Debug;
+            else if (strcmp(lv, "warn") == 0) minLevel = LogLevel::Warn;
+            else if (strcmp(lv, "error") == 0) minLevel = LogLevel::Error;
+        }
+        const char* fmt = getenv("BR31_LOG_FORMAT");
+        binary = (fmt != nullptr && strcmp(fmt, "binary") == 0);
+
+        running.store(true, std::memory_order_release);
+        pthread_create(&worker, nullptr, workerThread, this);
+    }
+
+    static auto nowNs() -> uint64_t {
+        timespec ts{};
+        clock_gettime(CLOCK_REALTIME, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    }
+
+    static void* workerThread(void* arg) {
+        reinterpret_cast<AsyncLogger*>(arg)->drainLoop();
+        return nullptr;
+    }
+
+    // 쌓인 레코드를 out 버퍼로 모아 write() 한 번으로 출력, 꺼낸 레코드 수 반환
+    auto drainBatch() -> int {
+        size_t used = 0;
+        int count = 0;
+        while (true) {
+            Cell& c = cells[dequeuePos & (LOG_QUEUE_SIZE - 1)];
+            if (c.seq.load(std::memory_order_acquire) != dequeuePos + 1) break;
+            size_t need = c.len + (binary ? sizeof(LogFrame) : 1);
+            if (used + need > sizeof(out)) break;
+
+            if (binary) {
+                LogFrame f{c.ts_ns, (uint16_t)c.level, c.len, 0};
+                memcpy(out + used, &f, sizeof(f));
+                used += sizeof(f);
+                memcpy(out + used, c.text, c.len);
+                used += c.len;
+            } else {
+                memcpy(out + used, c.text, c.len);
+                used += c.len;
+                out[used++] = '\n';
+            }
+            c.seq.store(dequeuePos + LOG_QUEUE_SIZE, std::memory_order_release);
+            ++dequeuePos;
+            ++count;
+        }
+        size_t off = 0;
+        while (off < used) {
+            ssize_t n = write(fd, out + off, used - off);
+            if (n <= 0) break;
+            off += n;
+        }
+        return count;
+    }
+
+    auto drainLoop() -> void {
+        while (true) {
+            if (drainBatch() > 0) continue;
+            if (!running.load(std::memory_order_acquire)) break;
+
+            // idle 표시 후 재확인 (push 의 publish 후 idle 확인과 짝)
+            consumerIdle.store(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            Cell& c = cells[dequeuePos & (LOG_QUEUE_SIZE - 1)];
+            if (c.seq.load(std::memory_order_acquire) == dequeuePos + 1 || !running.load(std::memory_order_acquire)) {
+                consumerIdle.store(0, std::memory_order_relaxed);
+                continue;
+            }
+            futexWait(&consumerIdle, 1);
+        }
+        while (drainBatch() > 0) {}
+    }
+
+    auto wakeConsumer() -> void {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (consumerIdle.load(std::memory_order_relaxed) == 1 && consumerIdle.exchange(0) == 1) {
+            futexWake(&consumerIdle, 1);
+        }
+    }
+public:
+    static auto instance() -> AsyncLogger& {
+        static AsyncLogger logger;
+        return logger;
+    }
+
+    auto enabled(LogLevel level) -> bool { return level >= minLevel; }
+
+    // 생산자 측 : 포맷된 본문을 링 슬롯 하나에 복사 (가득 차면 버리고 dropped 증가)
+    auto push(LogLevel level, const char* text, size_t len) -> void {
+        if (len > LOG_TEXT_MAX) len = LOG_TEXT_MAX;
+        uint64_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Cell* c;
+        while (true) {
+            c = &cells[pos & (LOG_QUEUE_SIZE - 1)];
+            uint64_t seq = c->seq.load(std::memory_order_acquire);
+            int64_t diff = (int64_t)seq - (int64_t)pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        c->ts_ns = binary ? nowNs() : 0;
+        c->level = level;
+        c->len = (uint16_t)len;
+        memcpy(c->text, text, len);
+        c->seq.store(pos + 1, std::memory_order_release);
+        wakeConsumer();
+    }
+
+    // 남은 레코드를 모두 출력하고 백그라운드 스레드 종료 (exit / kill 전에 호출)
+    auto shutdown() -> void {
+        if (!running.exchange(false)) return;
+        consumerIdle.store(0, std::memory_order_relaxed);
+        futexWake(&consumerIdle);
+        pthread_join(worker, nullptr);
+        uint64_t lost = dropped.load();
+        if (lost > 0) fprintf(stderr, "[ Logger ] 큐 포화로 버린 로그 %llu건\n", (unsigned long long)lost);
+    }
+
+    ~AsyncLogger() { shutdown(); }
+};
+
+// printf 형식 로그 (스레드별 버퍼에 포맷 -> 비동기 큐, 호출 스레드는 출력을 기다리지 않음)
+__attribute__((format(printf, 2, 3)))
+inline void logPrint(LogLevel level, const char* fmt, ...) {
+    AsyncLogger& logger = AsyncLogger::instance();
+    if (!logger.enabled(level)) return;
+
+    static thread_local char buf[LOG_TEXT_MAX + 1];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (n < 0) return;
+    logger.push(level, buf, (size_t)n < LOG_TEXT_MAX ? (size_t)n : LOG_TEXT_MAX);
+}
+
+inline void logShutdown() {
+    AsyncLogger::instance().shutdown();
+}
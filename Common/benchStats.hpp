@@ -0,0 +1,207 @@
+#pragma once // 벤치마크 드라이버(pipe_bench, sem_bench)가 함께 쓰는 지연 시간 통계 / 결과 출력
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <time.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <unistd.h>
+
+inline auto benchNowNs() -> uint64_t {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// 서버를 별도 프로세스 그룹으로 실행 (드라이버와 시그널 대상 분리), 로그는 /dev/null
+inline auto spawnBenchServer(char* const argv[]) -> pid_t {
+    pid_t pid = fork();
+    if (pid == 0) {
+        setpgid(0, 0);
+        int devnull = open("/dev/null", O_WRONLY);
+        if (devnull != -1) dup2(devnull, STDOUT_FILENO);
+        execv(argv[0], argv);
+        perror("execv");
+        _exit(127);
+    }
+    return pid;
+}
+
+// 조건이 참이 될 때까지 양보하며 대기 (코어가 하나여도 서버 실행을 막지 않음)
+template <typename F>
+inline void benchSpinUntil(F done) {
+    while (!done()) sched_yield();
+}
+
+// 턴 인계 지연 : 이전 플레이어가 자기 이동의 반영을 확인한 시각(lastApplyNs) -> 내가 턴을 감지한 시각(seen)
+// 이전 플레이어가 아직 시각을 기록하지 못했으면 (값이 내가 직전에 기록한 값 그대로) 잠시 기다림
+// 코어가 하나면 기록 스레드가 늦게 스케줄될 수 있어 최대 10ms 까지만 기다리고 표본을 버림
+inline auto benchHandoffSample(const std::atomic<uint64_t>& lastApplyNs, uint64_t myLast, uint64_t seen, uint64_t& out) -> bool {
+    uint64_t deadline = seen + 10000000ULL;
+    uint64_t prev;
+    while ((prev = lastApplyNs.load(std::memory_order_acquire)) == myLast || prev == 0) {
+        if (benchNowNs() > deadline) return false;
+        sched_yield();
+    }
+    out = seen > prev ? seen - prev : 0;
+    return true;
+}
+
+// [ SRP ] HDR 방식 지연 시간 히스토그램 (나노초)
+// 2의 거듭제곱 구간마다 SUB_BUCKETS 개의 선형 버킷 -> 상대 오차 약 3%, 기록 O(1) / 메모리 고정
+class LatencyHistogram {
+    static constexpr int SUB_BITS = 5;
+    static constexpr uint64_t SUB_BUCKETS = 1ULL << SUB_BITS;
+    static constexpr int BUCKETS = (64 - SUB_BITS + 1) * SUB_BUCKETS;
+
+    uint64_t counts[BUCKETS] = {};
+    uint64_t total = 0;
+    uint64_t maxValue = 0;
+    long double sum = 0;
+
+    static auto indexOf(uint64_t v) -> int {
+        if (v < SUB_BUCKETS) return (int)v;
+        int msb = 63 - __builtin_clzll(v);
+        int shift = msb - SUB_BITS;
+        return (int)(((uint64_t)(shift + 1) << SUB_BITS) | ((v >> shift) & (SUB_BUCKETS - 1)));
+    }
+
+    // 버킷에 들어가는 값의 상한 (백분위 보고용)
+    static auto upperOf(int idx) -> uint64_t {
+        if ((uint64_t)idx < SUB_BUCKETS) return (uint64_t)idx;
+        int shift = (idx >> SUB_BITS) - 1;
+        uint64_t base = (SUB_BUCKETS | ((uint64_t)idx & (SUB_BUCKETS - 1))) << shift;
+        return base + ((1ULL << shift) - 1);
+    }
+public:
+    auto record(uint64_t ns) -> void {
+        counts[indexOf(ns)]++;
+        total++;
+        sum += ns;
+        if (ns > maxValue) maxValue = ns;
+    }
+
+    auto merge(const LatencyHistogram& o) -> void {
+        for (int i = 0; i < BUCKETS; ++i) counts[i] += o.counts[i];
+        total += o.total;
+        sum += o.sum;
+        if (o.maxValue > maxValue) maxValue = o.maxValue;
+    }
+
+    auto count() const -> uint64_t { return total; }
+    auto max() const -> uint64_t { return maxValue; }
+    auto mean() const -> double { return total ? (double)(sum / total) : 0.0; }
+
+    // p : 0 ~ 100
+    auto percentile(double p) const -> uint64_t {
+        if (total == 0) return 0;
+        uint64_t rank = (uint64_t)(p / 100.0 * (double)total + 0.5);
+        if (rank < 1) rank = 1;
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKETS; ++i) {
+            seen += counts[i];
+            if (seen >= rank) return upperOf(i) < maxValue ? upperOf(i) : maxValue;
+        }
+        return maxValue;
+    }
+};
+
+// 전송 방식 하나의 측정 결과
+struct BenchResult {
+    std::string transport;      // fifo | sem | ring ...
+    int games = 0;
+    int players = 2;
+    uint64_t moves = 0;
+    double seconds = 0;
+    uint64_t syscalls = 0;      // 서버 수신 / 응답 경로 I/O 시스템 콜 (메트릭 M_SYSCALLS, 0 -> 측정 안 함)
+    LatencyHistogram submit;    // 이동 제출 -> 서버 반영이 공유 메모리에 보일 때까지
+    LatencyHistogram handoff;   // 이전 플레이어 이동 반영 -> 다음 플레이어가 자기 턴을 감지할 때까지
+};
+
+// 표 형식 (사람이 읽는 용도, stdout)
+inline void printBenchTable(const BenchResult& r) {
+    const LatencyHistogram* hs[2] = {&r.submit, &r.handoff};
+    const char* names[2] = {"submit_to_apply", "turn_handoff"};
+    printf("[ Bench ] transport=%s games=%d players=%d moves=%llu elapsed=%.3fs moves/s=%.1f", r.transport.c_str(), r.games, r.players,
+           (unsigned long long)r.moves, r.seconds, r.seconds > 0 ? r.moves / r.seconds : 0.0);
+    if (r.syscalls > 0 && r.moves > 0) printf(" syscalls/move=%.3f", (double)r.syscalls / r.moves);
+    printf("\n");
+    for (int i = 0; i < 2; ++i) {
+        if (hs[i]->count() == 0) {
+            printf("          %-16s (측정 안 함)\n", names[i]);
+            continue;
+        }
+        printf("          %-16s n=%-8llu p50=%10.1fus p99=%10.1fus p99.9=%10.1fus max=%10.1fus\n", names[i],
+               (unsigned long long)hs[i]->count(), hs[i]->percentile(50) / 1e3, hs[i]->percentile(99) / 1e3,
+               hs[i]->percentile(99.9) / 1e3, hs[i]->max() / 1e3);
+    }
+}
+
+// CSV : 지표마다 한 줄, 파일이 비어 있을 때만 헤더 출력 (여러 드라이버 결과를 한 파일에 누적)
+inline void appendBenchCsv(const char* path, const BenchResult& r) {
+    FILE* f = fopen(path, "a");
+    if (f == nullptr) { perror("fopen ( csv )"); return; }
+    fseek(f, 0, SEEK_END);
+    if (ftell(f) == 0) fprintf(f, "transport,metric,games,players,moves,elapsed_s,moves_per_s,count,p50_ns,p99_ns,p999_ns,max_ns,mean_ns,syscalls_per_move\n");
+    double perMove = r.syscalls > 0 && r.moves > 0 ? (double)r.syscalls / r.moves : 0.0;
+    const LatencyHistogram* hs[2] = {&r.submit, &r.handoff};
+    const char* names[2] = {"submit_to_apply", "turn_handoff"};
+    for (int i = 0; i < 2; ++i) {
+        fprintf(f, "%s,%s,%d,%d,%llu,%.6f,%.1f,%llu,%llu,%llu,%llu,%llu,%.0f,%.3f\n", r.transport.c_str(), names[i], r.games, r.players,
+                (unsigned long long)r.moves, r.seconds, r.seconds > 0 ? r.moves / r.seconds : 0.0,
+                (unsigned long long)hs[i]->count(), (unsigned long long)hs[i]->percentile(50),
+                (unsigned long long)hs[i]->percentile(99), (unsigned long long)hs[i]->percentile(99.9),
+                (unsigned long long)hs[i]->max(), hs[i]->mean(), perMove);
+    }
+    fclose(f);
+}
+
+// JSON Lines : 실행 하나당 객체 한 줄 (이어 붙여도 유효)
+inline void appendBenchJson(const char* path, const BenchResult& r) {
+    FILE* f = fopen(path, "a");
+    if (f == nullptr) { perror("fopen ( json )"); return; }
+    auto hist = [f](const char* name, const LatencyHistogram& h, bool last) {
+        fprintf(f, "\"%s\":{\"count\":%llu,\"p50_ns\":%llu,\"p99_ns\":%llu,\"p999_ns\":%llu,\"max_ns\":%llu,\"mean_ns\":%.0f}%s", name,
+                (unsigned long long)h.count(), (unsigned long long)h.percentile(50), (unsigned long long)h.percentile(99),
+                (unsigned long long)h.percentile(99.9), (unsigned long long)h.max(), h.mean(), last ? "" : ",");
+    };
+    fprintf(f, "{\"transport\":\"%s\",\"games\":%d,\"players\":%d,\"moves\":%llu,\"elapsed_s\":%.6f,\"moves_per_s\":%.1f,", r.transport.c_str(),
+            r.games, r.players, (unsigned long long)r.moves, r.seconds, r.seconds > 0 ? r.moves / r.seconds : 0.0);
+    if (r.syscalls > 0 && r.moves > 0) fprintf(f, "\"syscalls_per_move\":%.3f,", (double)r.syscalls / r.moves);
+    hist("submit_to_apply", r.submit, false);
+    hist("turn_handoff", r.handoff, true);
+    fprintf(f, "}\n");
+    fclose(f);
+}
+
+// 공통 실행 인자 : -g 게임 수, -p 게임당 플레이어 수, --csv 파일, --json 파일
+struct BenchOptions {
+    int games = 1;
+    int players = 2;
+    const char* csv = nullptr;
+    const char* json = nullptr;
+    const char* mode = nullptr; // 드라이버별 전송 방식 선택 (-m)
+
+    auto parse(int argc, char* argv[]) -> bool {
+        for (int i = 1; i < argc; ++i) {
+            bool hasNext = i + 1 < argc;
+            if (strcmp(argv[i], "-g") == 0 && hasNext) games = atoi(argv[++i]);
+            else if (strcmp(argv[i], "-p") == 0 && hasNext) players = atoi(argv[++i]);
+            else if (strcmp(argv[i], "-m") == 0 && hasNext) mode = argv[++i];
+            else if (strcmp(argv[i], "--csv") == 0 && hasNext) csv = argv[++i];
+            else if (strcmp(argv[i], "--json") == 0 && hasNext) json = argv[++i];
+            else return false;
+        }
+        return games > 0 && players >= 2;
+    }
+
+    auto report(const BenchResult& r) const -> void {
+        printBenchTable(r);
+        if (csv != nullptr) appendBenchCsv(csv, r);
+        if (json != nullptr) appendBenchJson(json, r);
+    }
+};
@@ -0,0 +1,24 @@
+#pragma once // 실행 인자 공통 처리 : 페이싱 / 인스턴스 옵션 적용 (서버 / 클라이언트 / 벤치 main 공통)
+
+#include "instance.hpp"
+#include "pacing.hpp"
+#include <iostream>
+
+enum CommonOption : unsigned {
+    OPT_PACING = 1,   // BR31_PACE / --pace normal|turbo|배율 / --turbo
+    OPT_INSTANCE = 2  // BR31_INSTANCE / --instance N, BR31_CPUS / --cpus 목록|auto
+};
+
+// 고른 옵션을 적용하고 argv 에서 제거 (나머지 위치 인자는 그대로)
+// 잘못된 값이면 허용 형식을 stderr 에 출력하고 false -> 호출자는 바로 종료
+inline auto configureCommon(int& argc, char* argv[], unsigned options = OPT_PACING | OPT_INSTANCE) -> bool {
+    if ((options & OPT_PACING) != 0 && !Pacing::configure(argc, argv)) {
+        std::cerr << "invalid pacing ( --pace normal|turbo|<scale> )" << std::endl;
+        return false;
+    }
+    if ((options & OPT_INSTANCE) != 0 && !Instance::configure(argc, argv)) {
+        std::cerr << "invalid instance ( --instance 0~" << INSTANCE_MAX << " --cpus <list>|auto )" << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,28 @@
+#pragma once // Pipe / Sem 서버가 함께 쓰는 futex 도우미
+
+#include <atomic>
+#include <cstdint>
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+// ===== futex (32비트 워드 대기/깨우기, 공유 메모리 위에서도 동작하도록 PRIVATE 아님) =====
+// timeout == nullptr 이면 무기한 대기, 값이 expected 와 다르면 즉시 반환
+inline int futexWait(std::atomic<uint32_t>* addr, uint32_t expected, const timespec* timeout = nullptr) {
+    return (int)syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAIT, expected, timeout, nullptr, 0);
+}
+
+inline int futexWake(std::atomic<uint32_t>* addr, int count = INT_MAX) {
+    return (int)syscall(SYS_futex, reinterpret_cast<uint32_t*>(addr), FUTEX_WAKE, count, nullptr, nullptr, 0);
+}
+
+// 스핀 대기 중 CPU 힌트 (시스템 콜 없음)
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
@@ -0,0 +1,134 @@
+#pragma once // 서버 인스턴스 : 인스턴스 id 로 IPC 키 / 경로 네임스페이스 + 프로세스 CPU 고정 (한 호스트에 서버 여러 개)
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#include <sys/types.h>
+
+#define INSTANCE_MAX 32767 // 키 상위 16비트에 들어가는 최대 id (key_t 양수 범위)
+
+// [ SRP ] 인스턴스 선택 (환경 변수 BR31_INSTANCE -> 실행 인자 --instance 순으로 적용)
+// 인스턴스 0 = 기존 키 / 경로 그대로 (이전 빌드의 클라이언트 / 도구와 호환)
+// 키 : (id << 16) | 기본 키 -> 기본 키는 모두 16비트 안이라 인스턴스끼리도, 한 인스턴스의 키끼리도 겹치지 않음
+//      (ftok 는 inode 하위 비트만 써서 다른 파일끼리 같은 키가 나올 수 있고, 기준 파일도 미리 있어야 함)
+// 경로 : 기본 경로 + ".<id>" (서버 FIFO / 소켓, 응답 FIFO 는 클라이언트 pid 라 원래 겹치지 않음)
+// CPU 고정 (BR31_CPUS / --cpus 목록|auto) : 프로세스 전체를 그 CPU 들에 묶음 -> 이후 만드는 스레드도 상속
+// ( auto : 허용된 CPU 중 id 번째(순환) 하나 -> 코어당 인스턴스 하나, --pin 은 그 안에서 워커를 다시 나눔 )
+class Instance {
+    static auto mutableId() -> int& {
+        static int id = 0;
+        return id;
+    }
+
+    static auto parseId(const char* s, int& out) -> bool {
+        char* end = nullptr;
+        long v = strtol(s, &end, 10);
+        if (end == s || *end != '\0' || v < 0 || v > INSTANCE_MAX) return false;
+        out = (int)v;
+        return true;
+    }
+
+    // "2" / "0-3" / "1,3,5-7" / "auto" -> cpu_set_t (허용된 CPU 밖이면 실패)
+    static auto parseCpus(const char* s, int id, cpu_set_t& set) -> bool {
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return false;
+        CPU_ZERO(&set);
+        if (strcmp(s, "auto") == 0) {
+            int n = CPU_COUNT(&allowed), want = n > 0 ? id % n : 0;
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &allowed) && want-- == 0) {
+                    CPU_SET(cpu, &set);
+                    return true;
+                }
+            }
+            return false;
+        }
+        const char* p = s;
+        while (*p != '\0') {
+            char* end = nullptr;
+            long lo = strtol(p, &end, 10), hi = lo;
+            if (end == p) return false;
+            p = end;
+            if (*p == '-') {
+                hi = strtol(++p, &end, 10);
+                if (end == p) return false;
+                p = end;
+            }
+            if (lo < 0 || hi < lo || hi >= CPU_SETSIZE) return false;
+            for (long cpu = lo; cpu <= hi; ++cpu) {
+                if (!CPU_ISSET(cpu, &allowed)) return false;
+                CPU_SET(cpu, &set);
+            }
+            if (*p == ',') ++p;
+            else if (*p != '\0') return false;
+        }
+        return CPU_COUNT(&set) > 0;
+    }
+public:
+    static auto id() -> int { return mutableId(); }
+
+    // BR31_INSTANCE / --instance N, BR31_CPUS / --cpus 목록|auto 적용 후 argv 에서 제거, 잘못된 값이면 false
+    // 인자로 정한 id 는 환경 변수에도 기록 -> fork / exec 한 서버 / 클라이언트(벤치)가 같은 인스턴스를 씀
+    static auto configure(int& argc, char* argv[]) -> bool {
+        const char* inst = getenv("BR31_INSTANCE");
+        const char* cpus = getenv("BR31_CPUS");
+        bool fromArg = false;
+        int out = 1;
+        for (int i = 1; i < argc; ++i) {
+            if (strcmp(argv[i], "--instance") == 0 && i + 1 < argc) {
+                inst = argv[++i];
+                fromArg = true;
+            } else if (strcmp(argv[i], "--cpus") == 0 && i + 1 < argc) {
+                cpus = argv[++i];
+            } else {
+                argv[out++] = argv[i];
+            }
+        }
+        argc = out;
+        argv[argc] = nullptr;
+
+        if (inst != nullptr && *inst != '\0' && !parseId(inst, mutableId())) return false;
+        if (fromArg) setenv("BR31_INSTANCE", inst, 1);
+        if (cpus != nullptr && *cpus != '\0') {
+            cpu_set_t set;
+            if (!parseCpus(cpus, id(), set)) return false;
+            if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+                perror("sched_setaffinity");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 지금 프로세스가 돌 수 있는 CPU 수 (서버 시작 로그용)
+    static auto cpuCount() -> int {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        return sched_getaffinity(0, sizeof(set), &set) == 0 ? CPU_COUNT(&set) : 0;
+    }
+
+    static auto key(key_t base) -> key_t { return (key_t)(((unsigned)id() << 16) | (unsigned)base); }
+
+    // 인스턴스 0 이면 base 그대로, 아니면 "base.<id>" (기본 경로마다 한 번 만들어 두고 같은 포인터 반환)
+    static auto path(const char* base) -> const char* {
+        if (id() == 0) return base;
+        static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+        static std::deque<std::pair<const char*, std::string>> paths; // deque : 추가해도 기존 문자열 위치 유지
+        pthread_mutex_lock(&lock);
+        const char* found = nullptr;
+        for (auto& p : paths) {
+            if (p.first == base || strcmp(p.first, base) == 0) found = p.second.c_str();
+        }
+        if (found == nullptr) {
+            paths.emplace_back(base, std::string(base) + "." + std::to_string(id()));
+            found = paths.back().second.c_str();
+        }
+        pthread_mutex_unlock(&lock);
+        return found;
+    }
+};
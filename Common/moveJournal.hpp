@@ -0,0 +1,284 @@
+#pragma once // 반영된 이동을 기록하는 mmap 추가 전용(append-only) 바이너리 저널 + 재생용 리더
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// 디렉터리 하나 = 저널 하나, 고정 크기 세그먼트 파일(seg-000000.br31j ...)을 미리 할당해 순서대로 채움
+// 세그먼트 = JournalSegmentHeader(64바이트) + JournalRecord(16바이트) 배열, 빈 슬롯은 0
+#define JOURNAL_MAGIC 0x4C4E524A31335242ULL // "BR31JRNL" (리틀 엔디언)
+#define JOURNAL_VERSION 1
+#define JOURNAL_SEGMENT_BYTES (4u << 20)    // 세그먼트 하나 4MiB (레코드 약 26만 개)
+#define JOURNAL_GROUP_COMMIT 256            // durable 모드 : 이 개수마다 또는 commit() 호출마다 msync
+
+enum JournalFlags : uint8_t {
+    JR_START = 1,    // 게임 시작 (player = 첫 턴, cnt = 플레이어 수)
+    JR_MOVE = 2,     // 이동 반영
+    JR_FINISHED = 4, // 이번 이동으로 게임 종료 (player 패배)
+    JR_FORFEIT = 8   // 턴 기한 초과 기권 (JR_MOVE | JR_FINISHED 와 함께, cnt 0 / number 그대로)
+};
+
+struct JournalSegmentHeader {
+    uint64_t magic;        // JOURNAL_MAGIC
+    uint32_t version;      // JOURNAL_VERSION
+    uint32_t index;        // 세그먼트 번호 (0부터)
+    uint32_t record_size;  // sizeof(JournalRecord)
+    uint32_t capacity;     // 세그먼트에 들어가는 레코드 수
+    uint64_t first_seq;    // 이 세그먼트 첫 레코드의 seq
+    uint8_t reserved[32];
+};
+
+struct JournalRecord {
+    uint32_t seq;        // 1부터 증가, 0 = 빈 슬롯 (다른 필드를 쓴 뒤 마지막에 기록 -> 끊긴 레코드는 재생 시 무시)
+    uint32_t game_id;
+    uint16_t number;     // 반영 후 숫자 (JR_START 는 0)
+    uint8_t player;      // 이동한 플레이어 (JR_START : 첫 턴)
+    uint8_t cnt;         // 외친 개수 (JR_START : 플레이어 수)
+    uint8_t next_turn;   // 반영 후 턴
+    uint8_t flags;       // JournalFlags
+    uint16_t reserved;
+};
+
+static_assert(sizeof(JournalSegmentHeader) == 64, "journal segment header layout");
+static_assert(sizeof(JournalRecord) == 16, "journal record layout");
+
+#define JOURNAL_CAPACITY ((JOURNAL_SEGMENT_BYTES - sizeof(JournalSegmentHeader)) / sizeof(JournalRecord))
+
+inline void journalSegmentPath(char* out, size_t size, const char* dir, uint32_t index) {
+    snprintf(out, size, "%s/seg-%06u.br31j", dir, index);
+}
+
+// 저널 옵션 (--journal <dir> / --durable 또는 BR31_JOURNAL / BR31_JOURNAL_SYNC=1), argv 에서 제거
+struct JournalOptions {
+    const char* dir = nullptr; // nullptr -> 저널 사용 안 함
+    bool durable = false;
+
+    auto configure(int& argc, char* argv[]) -> void {
+        const char* env = getenv("BR31_JOURNAL");
+        if (env != nullptr && *env != '\0') dir = env;
+        const char* sync = getenv("BR31_JOURNAL_SYNC");
+        durable = (sync != nullptr && strcmp(sync, "1") == 0);
+
+        int out = 1;
+        for (int i = 1; i < argc; ++i) {
+            if (strcmp(argv[i], "--journal") == 0 && i + 1 < argc) dir = argv[++i];
+            else if (strcmp(argv[i], "--durable") == 0) durable = true;
+            else argv[out++] = argv[i];
+        }
+        argc = out;
+        argv[argc] = nullptr;
+    }
+};
+
+// [ SRP ] 저널 쓰기 전담 (단일 쓰기 스레드 전제 : 서버 메인 루프)
+// append 는 mmap 된 페이지에 16바이트 복사 한 번 (시스템 콜 없음), 세그먼트가 차면 다음 파일을 할당해 교체
+// durable 이면 JOURNAL_GROUP_COMMIT 개마다 또는 commit() 에서 더티 구간만 msync(MS_SYNC)
+class MoveJournal {
+    char dir[256] = "";
+    bool durable = false;
+    int fd = -1;
+    uint8_t* base = nullptr;
+    JournalRecord* records = nullptr;
+    uint32_t segment = 0;
+    uint32_t used = 0;       // 현재 세그먼트에 쓴 레코드 수
+    uint32_t synced = 0;     // 현재 세그먼트에서 msync 까지 끝난 레코드 수
+    uint32_t seq = 0;
+
+    auto mapSegment(uint32_t index) -> bool {
+        char path[320];
+        journalSegmentPath(path, sizeof(path), dir, index);
+        fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd == -1) { perror("open ( journal )"); return false; }
+        int rc = posix_fallocate(fd, 0, JOURNAL_SEGMENT_BYTES); // 미리 할당 -> 쓰는 도중 ENOSPC(SIGBUS) 방지
+        if (rc != 0) { errno = rc; perror("posix_fallocate ( journal )"); ::close(fd); fd = -1; return false; }
+
+        void* p = mmap(nullptr, JOURNAL_SEGMENT_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+        if (p == MAP_FAILED) { perror("mmap ( journal )"); ::close(fd); fd = -1; return false; }
+        base = (uint8_t*)p;
+        records = (JournalRecord*)(base + sizeof(JournalSegmentHeader));
+
+        JournalSegmentHeader* h = (JournalSegmentHeader*)base;
+        h->version = JOURNAL_VERSION;
+        h->index = index;
+        h->record_size = sizeof(JournalRecord);
+        h->capacity = (uint32_t)JOURNAL_CAPACITY;
+        h->first_seq = (uint64_t)seq + 1;
+        __atomic_store_n(&h->magic, JOURNAL_MAGIC, __ATOMIC_RELEASE);
+        segment = index;
+        used = synced = 0;
+        return true;
+    }
+
+    auto unmapSegment() -> void {
+        if (base == nullptr) return;
+        sync();
+        munmap(base, JOURNAL_SEGMENT_BYTES);
+        ::close(fd);
+        base = nullptr;
+        records = nullptr;
+        fd = -1;
+    }
+
+    // 아직 msync 하지 않은 레코드가 걸친 페이지만 동기화 (헤더 포함 첫 페이지는 첫 동기화 때 함께)
+    auto sync() -> void {
+        if (!durable || base == nullptr || synced == used) return;
+        size_t from = synced == 0 ? 0 : sizeof(JournalSegmentHeader) + (size_t)synced * sizeof(JournalRecord);
+        size_t to = sizeof(JournalSegmentHeader) + (size_t)used * sizeof(JournalRecord);
+        size_t page = (size_t)sysconf(_SC_PAGESIZE);
+        from &= ~(page - 1);
+        if (msync(base + from, to - from, MS_SYNC) == -1) perror("msync ( journal )");
+        synced = used;
+    }
+    // 마지막 세그먼트를 다시 열어 유효한 레코드 다음부터 이어 씀 (끊긴 레코드 자리는 덮어씀)
+    auto resumeLast() -> bool {
+        char path[320];
+        uint32_t last = 0;
+        bool found = false;
+        for (uint32_t i = 0;; ++i) {
+            journalSegmentPath(path, sizeof(path), dir, i);
+            if (access(path, F_OK) != 0) break;
+            last = i;
+            found = true;
+        }
+        if (!found) return false;
+
+        journalSegmentPath(path, sizeof(path), dir, last);
+        fd = ::open(path, O_RDWR | O_CLOEXEC);
+        if (fd == -1) return false;
+        struct stat st{};
+        void* p = MAP_FAILED;
+        if (fstat(fd, &st) == 0 && st.st_size == (off_t)JOURNAL_SEGMENT_BYTES) {
+            p = mmap(nullptr, JOURNAL_SEGMENT_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+        }
+        const JournalSegmentHeader* h = (const JournalSegmentHeader*)p;
+        if (p == MAP_FAILED || h->magic != JOURNAL_MAGIC || h->version != JOURNAL_VERSION || h->record_size != sizeof(JournalRecord)) {
+            if (p != MAP_FAILED) munmap(p, JOURNAL_SEGMENT_BYTES);
+            ::close(fd);
+            fd = -1;
+            return false;
+        }
+        base = (uint8_t*)p;
+        records = (JournalRecord*)(base + sizeof(JournalSegmentHeader));
+        segment = last;
+        used = 0;
+        while (used < JOURNAL_CAPACITY && records[used].seq == h->first_seq + used) ++used;
+        synced = used;
+        seq = (uint32_t)(h->first_seq + used - 1);
+        return true;
+    }
+public:
+    // 기본 : 디렉터리의 이전 세그먼트를 지우고 0번부터 새로 시작
+    // resume : 기존 저널 끝에 이어 씀 (웜 재시작), 저널이 없거나 헤더가 맞지 않으면 새로 시작
+    auto open(const JournalOptions& opt, bool resume = false) -> bool {
+        if (opt.dir == nullptr) return false;
+        snprintf(dir, sizeof(dir), "%s", opt.dir);
+        durable = opt.durable;
+        if (mkdir(dir, 0755) == -1 && errno != EEXIST) { perror("mkdir ( journal )"); return false; }
+        if (resume && resumeLast()) return true;
+        char path[320];
+        for (uint32_t i = 0;; ++i) {
+            journalSegmentPath(path, sizeof(path), dir, i);
+            if (unlink(path) == -1) break;
+        }
+        seq = 0;
+        return mapSegment(0);
+    }
+
+    auto isOpen() const -> bool { return base != nullptr; }
+    auto lastSeq() const -> uint32_t { return seq; }
+
+    auto append(uint32_t gameId, uint8_t flags, int player, int cnt, int number, int nextTurn) -> void {
+        if (base == nullptr) return;
+        if (used == JOURNAL_CAPACITY) {
+            unmapSegment();
+            if (!mapSegment(segment + 1)) return;
+        }
+        JournalRecord& r = records[used++];
+        r.game_id = gameId;
+        r.number = (uint16_t)number;
+        r.player = (uint8_t)player;
+        r.cnt = (uint8_t)cnt;
+        r.next_turn = (uint8_t)nextTurn;
+        r.flags = flags;
+        r.reserved = 0;
+        __atomic_store_n(&r.seq, ++seq, __ATOMIC_RELEASE);
+        if (durable && used - synced >= JOURNAL_GROUP_COMMIT) sync();
+    }
+
+    // 그룹 커밋 지점 (서버는 배치 하나를 처리한 뒤, 응답을 보내기 전에 호출)
+    auto commit() -> void { sync(); }
+
+    auto close() -> void { unmapSegment(); }
+
+    ~MoveJournal() { close(); }
+};
+
+// [ SRP ] 저널 읽기 전담 (세그먼트를 순서대로 읽기 전용 mmap, 끊긴 레코드 / 빈 슬롯에서 종료)
+class JournalReader {
+    const char* dir;
+    uint32_t visited = 0; // 읽은 세그먼트 수
+    const uint8_t* base = nullptr;
+    int fd = -1;
+    uint64_t expectSeq = 1;
+    bool torn = false;
+
+    auto mapSegment(uint32_t index) -> bool {
+        char path[320];
+        journalSegmentPath(path, sizeof(path), dir, index);
+        fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd == -1) return false;
+        void* p = mmap(nullptr, JOURNAL_SEGMENT_BYTES, PROT_READ, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED) { ::close(fd); fd = -1; return false; }
+        madvise(p, JOURNAL_SEGMENT_BYTES, MADV_SEQUENTIAL);
+        const JournalSegmentHeader* h = (const JournalSegmentHeader*)p;
+        if (h->magic != JOURNAL_MAGIC || h->version != JOURNAL_VERSION || h->record_size != sizeof(JournalRecord)) {
+            munmap(p, JOURNAL_SEGMENT_BYTES);
+            ::close(fd);
+            fd = -1;
+            return false;
+        }
+        base = (const uint8_t*)p;
+        ++visited;
+        return true;
+    }
+
+    auto unmap() -> void {
+        if (base == nullptr) return;
+        munmap((void*)base, JOURNAL_SEGMENT_BYTES);
+        ::close(fd);
+        base = nullptr;
+        fd = -1;
+    }
+public:
+    explicit JournalReader(const char* d) : dir{d} {}
+
+    auto segments() const -> uint32_t { return visited; }
+    auto endedTorn() const -> bool { return torn; } // seq 가 이어지지 않는 레코드에서 멈춤 (쓰기 도중 종료)
+
+    // 세그먼트 단위로 유효한 레코드 구간을 f(const JournalRecord*, count) 로 전달, 전체 레코드 수 반환
+    template <typename F>
+    auto forEachRun(F f) -> uint64_t {
+        uint64_t total = 0;
+        for (uint32_t index = 0; mapSegment(index); ++index) {
+            const JournalRecord* recs = (const JournalRecord*)(base + sizeof(JournalSegmentHeader));
+            uint32_t n = 0;
+            while (n < JOURNAL_CAPACITY && recs[n].seq == expectSeq + n) ++n;
+            if (n > 0) f(recs, n);
+            total += n;
+            expectSeq += n;
+            bool full = n == JOURNAL_CAPACITY;
+            if (!full) torn = recs[n].seq != 0;
+            unmap();
+            if (!full) break;
+        }
+        return total;
+    }
+
+    ~JournalReader() { unmap(); }
+};
@@ -0,0 +1,83 @@
+#pragma once // 서버 / 클라이언트의 연출용 지연을 한 곳에서 설정하는 페이싱 정책
+
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+// 지연 값 (마이크로초, 0 이면 지연 없음)
+struct PacingPolicy {
+    useconds_t numberUs;    // 서버 : 숫자 하나를 외칠 때마다
+    useconds_t turnUs;      // 서버 : 턴과 턴 사이
+    useconds_t broadcastUs; // 서버 : 브로드캐스터 상태 확인 주기
+    useconds_t startupUs;   // 서버 : 수신 스레드 시작 후 브로드캐스터 시작까지
+    useconds_t thinkUs;     // 클라이언트 : 숫자 하나를 외칠 때마다
+    useconds_t turnEndUs;   // 클라이언트 : 자기 턴을 마친 뒤
+    useconds_t pollUs;      // 공유 메모리 상태 폴링 주기 (연출이 아닌 대기 간격)
+};
+
+// [ SRP ] 페이싱 정책 선택 (환경 변수 BR31_PACE -> 실행 인자 --pace 순으로 적용)
+// normal : 기존 연출 속도, turbo : 인위적 지연 없음, 숫자(ex 0.1) : normal 지연에 배율 적용
+class Pacing {
+    static auto normal() -> PacingPolicy {
+        return PacingPolicy{250000, 300000, 350000, 2000000, 300000, 200000, 50000};
+    }
+
+    static auto turbo() -> PacingPolicy {
+        return PacingPolicy{0, 0, 1000, 0, 0, 0, 50};
+    }
+
+    static auto scaled(double f) -> PacingPolicy {
+        PacingPolicy p = normal();
+        useconds_t* fields[] = {&p.numberUs, &p.turnUs, &p.broadcastUs, &p.startupUs, &p.thinkUs, &p.turnEndUs, &p.pollUs};
+        for (useconds_t* v : fields) *v = (useconds_t)(*v * f);
+        if (p.pollUs < 50) p.pollUs = 50;
+        if (p.broadcastUs < 1000) p.broadcastUs = 1000;
+        return p;
+    }
+
+    static auto mutablePolicy() -> PacingPolicy& {
+        static PacingPolicy p = normal();
+        return p;
+    }
+public:
+    static auto get() -> const PacingPolicy& { return mutablePolicy(); }
+
+    static auto isTurbo() -> bool { return get().numberUs == 0 && get().turnUs == 0; }
+
+    // 모드 문자열 적용, 알 수 없는 값이면 false
+    static auto select(const char* mode) -> bool {
+        if (strcmp(mode, "normal") == 0) mutablePolicy() = normal();
+        else if (strcmp(mode, "turbo") == 0) mutablePolicy() = turbo();
+        else {
+            char* end = nullptr;
+            double f = strtod(mode, &end);
+            if (end == mode || *end != '\0' || f < 0) return false;
+            mutablePolicy() = scaled(f);
+        }
+        return true;
+    }
+
+    // BR31_PACE 와 --pace <mode> / --turbo 를 적용하고 argv 에서 제거 (나머지 위치 인자는 그대로 유지)
+    static auto configure(int& argc, char* argv[]) -> bool {
+        const char* env = getenv("BR31_PACE");
+        if (env != nullptr && !select(env)) return false;
+
+        int out = 1;
+        for (int i = 1; i < argc; ++i) {
+            if (strcmp(argv[i], "--turbo") == 0) {
+                select("turbo");
+            } else if (strcmp(argv[i], "--pace") == 0 && i + 1 < argc) {
+                if (!select(argv[++i])) return false;
+            } else {
+                argv[out++] = argv[i];
+            }
+        }
+        argc = out;
+        argv[argc] = nullptr;
+        return true;
+    }
+};
+
+inline void paceSleep(useconds_t us) {
+    if (us > 0) usleep(us);
+}
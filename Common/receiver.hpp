@@ -0,0 +1,28 @@
+#pragma once // 입력 수신 채널 인터페이스 : 전송 방식(FIFO, 공유 메모리 링 ...)과 게임 엔진 사이의 경계 (sem_server / br31_server 공통)
+
+#include <cstdint>
+#include <time.h>
+#include "taskExecutor.hpp"
+
+// IReceiver (추상 클래스 / 인터페이스)
+// executor 의 작업 하나 : poll 은 도착한 입력을 처리하고, 없으면 최대 waitNs 동안 대기 (0 -> wake 까지 무기한)
+class IReceiver {
+public:
+    virtual auto poll(const StopToken& stop, uint64_t waitNs) -> TaskStep = 0;
+    virtual void wake() = 0; // 대기 중인 poll 깨우기 (정지 요청 시)
+    virtual ~IReceiver() = default;
+};
+
+// IMoveSink (추상 클래스 / 인터페이스)
+// 수신기가 꺼낸 이동을 넘겨받는 쪽 (게임 엔진 어댑터) -> 수신기는 게임 상태가 어디에 있는지 모름
+class IMoveSink {
+public:
+    virtual auto gameOver() -> bool = 0;
+    virtual void submit(int playerId, int cnt) = 0;
+    virtual ~IMoveSink() = default;
+};
+
+// 제한 대기 시간 (ns) -> semtimedop / futex 용 상대 timespec
+inline auto waitTimeout(uint64_t waitNs) -> timespec {
+    return timespec{(time_t)(waitNs / 1000000000ULL), (long)(waitNs % 1000000000ULL)};
+}
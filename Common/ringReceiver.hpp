@@ -0,0 +1,79 @@
+#pragma once // 공유 메모리 SPSC 링 수신기 (sem_server ring / br31_server --transport ring 공통)
+
+#include <string>
+#include "receiver.hpp"
+#include "shmRing.hpp"
+#include "asyncLogger.hpp"
+#include "serverMetrics.hpp"
+
+// [ OCP : 개방 폐쇄 원칙 ] -> 공유 메모리 SPSC 링 기반 입력 수신 채널
+// [ SRP : 단일 책임 원칙 ] -> 플레이어 한 명의 링을 소비해 IMoveSink 에 전달
+// 링에 이동이 있으면 시스템 콜 없이 꺼내고, 잠깐 스핀해도 비어 있을 때만 futex 대기
+class ShmRingReceiver : public IReceiver {
+    ShmRing* ring;
+    int playerId;
+    IMoveSink& sink;
+    ServerMetrics& metricsOwner;
+    MetricsSlot* metrics = nullptr; // 처음 poll 할 때 발급 (워커가 바뀌어도 같은 슬롯)
+    uint64_t drained = 0; // 직전 futex 대기 이후 소비한 이동 수
+    static constexpr int SPIN_LIMIT = 4096; // futex 대기 전 빈 링 재확인 횟수
+
+    // 꺼내기만 하고 tail 은 반영 후 consume 에서 증가
+    // -> 반영 전에 서버가 죽으면 재시작 후 같은 이동을 다시 처리 (이미 반영됐다면 턴 검증에서 무시)
+    bool peek(RingMove& mv) {
+        uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+        if (tail == ring->head.load(std::memory_order_acquire)) return false;
+        mv = ring->slots[tail & (RING_CAPACITY - 1)];
+        return true;
+    }
+    void consume() {
+        ring->tail.store(ring->tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+public:
+    ShmRingReceiver(ShmRing* r, int pid, IMoveSink& s, ServerMetrics& m) : ring{r}, playerId{pid}, sink{s}, metricsOwner{m} {}
+    auto poll(const StopToken& stop, uint64_t waitNs) -> TaskStep override {
+        if (metrics == nullptr) metrics = &metricsOwner.claim(("ring P" + std::to_string(playerId)).c_str());
+        threadMetrics() = metrics;
+        int idleSpins = 0;
+        while (!stop.stopRequested() && !sink.gameOver()) {
+            RingMove mv;
+            if (peek(mv)) {
+                idleSpins = 0;
+                ++drained;
+                metrics->add(M_RECORDS_READ);
+                logPrint(LogLevel::Info, "[  ShmRing  ] ( 신호 감지 -> 턴 진행 P%d )", playerId);
+                sink.submit(playerId, mv.cnt); // 개수 검증은 엔진 쪽 (범위 밖이면 반영 없이 버림)
+                consume();
+                continue;
+            }
+            if (++idleSpins < SPIN_LIMIT) {
+                cpuRelax();
+                continue;
+            }
+            idleSpins = 0;
+
+            // idle 표시 후 재확인 (ringPush 의 head 공개 후 idle 확인과 짝)
+            ring->consumer_idle.store(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (ring->head.load(std::memory_order_relaxed) != ring->tail.load(std::memory_order_relaxed)
+                || stop.stopRequested()) {
+                ring->consumer_idle.store(0, std::memory_order_relaxed);
+                continue;
+            }
+            if (drained > 0) metrics->record(H_BATCH, drained);
+            drained = 0;
+            timespec timeout = waitTimeout(waitNs);
+            uint64_t waitStart = metricsNowNs();
+            futexWait(&ring->consumer_idle, 1, waitNs > 0 ? &timeout : nullptr);
+            metrics->add(M_WAKEUPS);
+            metrics->record(H_WAIT_NS, metricsNowNs() - waitStart);
+            // 워커를 나눠 쓰면 대기 한 번마다 양보 (idle 표시는 남겨 생산자가 다음 push 때 깨우게 함)
+            if (waitNs > 0) return TaskStep::Yield;
+        }
+        return TaskStep::Done;
+    }
+    void wake() override {
+        ring->consumer_idle.store(0, std::memory_order_relaxed);
+        futexWake(&ring->consumer_idle);
+    }
+};
@@ -0,0 +1,114 @@
+#pragma once // 서버 메트릭 : 공유 메모리의 고정 레이아웃 카운터 / 지연 히스토그램 (br31_stat 이 읽기 전용으로 부착)
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <time.h>
+#include "shmRecovery.hpp"
+#include "instance.hpp"
+
+// 전송별 메트릭 세그먼트 키 (게임 상태 세그먼트와 별도 -> 레이아웃이 바뀌어도 게임 세그먼트와 무관, 인스턴스별)
+#define METRICS_KEY_PIPE Instance::key(60021)
+#define METRICS_KEY_SEM Instance::key(60016)
+#define METRICS_KEY_SERVER Instance::key(60022) // br31_server (전송 여러 개가 한 세그먼트에 수신기별 슬롯으로 기록)
+#define METRICS_LAYOUT 2
+#define METRICS_MAX_THREADS 16   // 스레드별 슬롯 수 (넘치면 공용 더미 슬롯에 기록)
+#define METRICS_HIST_BUCKETS 64  // log2 버킷 : i 번 = [2^i, 2^(i+1)), 0 번은 0 ~ 1
+
+enum MetricCounter {
+    M_MOVES_APPLIED,  // 반영된 이동
+    M_WRONG_TURN,     // 턴 주인이 아닌 이동 거절 ([ logic ] 잘못된 턴 접근)
+    M_GAMES_FINISHED, // 이번 이동으로 끝난 게임
+    M_WAKEUPS,        // 대기(epoll / semop / futex)에서 깨어난 횟수
+    M_RECORDS_READ,   // 깨어나서 읽은 입력 레코드 수
+    M_SYSCALLS,       // 수신 / 응답 경로의 I/O 시스템 콜 (대기, 읽기, 응답 쓰기, io_uring_enter / 연결 수립 / 종료는 제외)
+    M_COUNTERS
+};
+
+enum MetricHistogram {
+    H_WAIT_NS,        // 입력 대기로 블록된 시간 (ns)
+    H_APPLY_NS,       // 이동 하나 반영 시간 (ns, 연출 지연 포함)
+    H_BATCH,          // 깨어날 때마다 읽은 레코드 수
+    M_HISTOGRAMS
+};
+
+// 스레드 하나 전용 (쓰는 스레드가 하나라 load + store 로 증가 -> lock 접두 명령 없음, 읽는 쪽은 relaxed load)
+struct alignas(64) MetricsSlot {
+    std::atomic<uint32_t> in_use;  // 1 -> 스레드가 사용 중
+    char name[28];                 // ex) "main", "sem P1", "ring P2", "fifo"
+    alignas(64) std::atomic<uint64_t> counters[M_COUNTERS];
+    alignas(64) std::atomic<uint64_t> hist[M_HISTOGRAMS][METRICS_HIST_BUCKETS];
+
+    auto add(MetricCounter c, uint64_t n = 1) -> void {
+        counters[c].store(counters[c].load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    auto record(MetricHistogram h, uint64_t value) -> void {
+        int bucket = value == 0 ? 0 : 63 - __builtin_clzll(value);
+        std::atomic<uint64_t>& b = hist[h][bucket];
+        b.store(b.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+};
+
+struct MetricsBlock {
+    ShmHeader header;                  // magic / 레이아웃 버전 / 세대 (br31_stat 검증용)
+    uint64_t started_ns;               // 서버 시작 시각 (CLOCK_MONOTONIC, 시작 이후 평균 계산용)
+    std::atomic<uint32_t> slots_used;  // 발급한 슬롯 수
+    alignas(64) MetricsSlot slots[METRICS_MAX_THREADS];
+}; // 메트릭 공유 메모리 구조체
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "metrics counters must be lock-free in shared memory");
+
+inline auto metricsNowNs() -> uint64_t {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// 세그먼트가 없거나 슬롯이 모자랄 때 쓰는 스레드 내부 슬롯 (기록은 버려지는 셈, 스레드별이라 워커끼리 캐시 라인 공유 없음)
+inline auto metricsDummySlot() -> MetricsSlot& {
+    thread_local MetricsSlot dummy{};
+    return dummy;
+}
+
+// 현재 스레드의 슬롯 (수신 스레드가 시작할 때 ServerMetrics::claim 결과로 지정, 공통 코드는 여기에 기록)
+inline auto threadMetrics() -> MetricsSlot*& {
+    thread_local MetricsSlot* slot = &metricsDummySlot();
+    return slot;
+}
+
+// [ SRP ] 메트릭 세그먼트 소유 (서버) : 시작 시 새로 초기화, 스레드마다 슬롯 하나 발급
+class ServerMetrics {
+    int shmId = -1;
+    MetricsBlock* block = nullptr;
+public:
+    auto open(key_t key) -> bool {
+        if (shmAttach(key, METRICS_LAYOUT, false, shmId, block) == ShmAttach::Failed) {
+            block = nullptr;
+            return false;
+        }
+        block->started_ns = metricsNowNs();
+        return true;
+    }
+
+    // 슬롯 발급 후 호출한 스레드의 슬롯으로 지정 (세그먼트가 없거나 가득 차면 더미)
+    auto claim(const char* name) -> MetricsSlot& {
+        MetricsSlot* slot = &metricsDummySlot();
+        if (block != nullptr) {
+            uint32_t i = block->slots_used.fetch_add(1, std::memory_order_relaxed);
+            if (i < METRICS_MAX_THREADS) {
+                slot = &block->slots[i];
+                snprintf(slot->name, sizeof(slot->name), "%s", name);
+                slot->in_use.store(1, std::memory_order_release);
+            }
+        }
+        threadMetrics() = slot;
+        return *slot;
+    }
+
+    // 정상 종료 시 세그먼트 삭제 예약 (떼지는 않음 -> 분리된 수신 스레드가 마지막까지 기록해도 안전, 프로세스 종료 시 자동 분리)
+    auto remove() -> void {
+        if (block != nullptr) shmctl(shmId, IPC_RMID, nullptr);
+    }
+};
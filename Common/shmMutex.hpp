@@ -0,0 +1,56 @@
+#pragma once // 공유 메모리 세그먼트 안에 두는 프로세스 공유 robust 뮤텍스 + 잠금 없는 필드 읽기 / 쓰기
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <pthread.h>
+
+// 세그먼트를 새로 만든 쪽(서버)이 한 번 초기화, 재부착 시에는 그대로 사용 (죽은 주인의 잠금은 ShmLock 이 회수)
+inline auto shmMutexInit(pthread_mutex_t& m) -> bool {
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+    int rc = pthread_mutex_init(&m, &attr);
+    pthread_mutexattr_destroy(&attr);
+    if (rc != 0) fprintf(stderr, "[ ShmLock ] pthread_mutex_init : %s\n", strerror(rc));
+    return rc == 0;
+}
+
+// [ SRP ] 잠금 구간 RAII
+// 잠근 채 죽은 프로세스가 있으면 (EOWNERDEAD) repair 로 보호 데이터를 맞춘 뒤 consistent 표시 -> 이후 잠금은 정상
+// consistent 없이 풀린 뮤텍스(ENOTRECOVERABLE)는 더 쓸 수 없으므로 locked() 가 false (호출자는 쓰기를 포기)
+class ShmLock {
+    pthread_mutex_t& m;
+    bool held = false;
+    bool recovered = false;
+public:
+    template <typename Repair>
+    ShmLock(pthread_mutex_t& mutex, Repair repair) : m{mutex} {
+        int rc = pthread_mutex_lock(&m);
+        if (rc == EOWNERDEAD) {
+            repair();
+            pthread_mutex_consistent(&m);
+            recovered = true;
+            rc = 0;
+        }
+        held = rc == 0;
+        if (!held) fprintf(stderr, "[ ShmLock ] pthread_mutex_lock : %s\n", strerror(rc));
+    }
+
+    auto locked() const -> bool { return held; }
+    auto ownerDied() const -> bool { return recovered; }
+
+    ShmLock(const ShmLock&) = delete;
+    ShmLock& operator=(const ShmLock&) = delete;
+    ~ShmLock() {
+        if (held) pthread_mutex_unlock(&m);
+    }
+};
+
+// 잠금 없이 폴링하는 필드 (턴 / 종료 / 숫자) : 쓰는 쪽은 잠금 안에서 shmStore, 읽는 쪽은 shmLoad
+template <typename T>
+inline auto shmLoad(const T& v) -> T { return __atomic_load_n(&v, __ATOMIC_ACQUIRE); }
+
+template <typename T>
+inline auto shmStore(T& v, T x) -> void { __atomic_store_n(&v, x, __ATOMIC_RELEASE); }
@@ -0,0 +1,144 @@
+#pragma once // 공유 메모리 웜 재시작 : 버전 헤더 검증 후 재부착 + 반쯤 반영된 이동 복구
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <signal.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <unistd.h>
+#include "turnRing.hpp"
+
+// 세그먼트 맨 앞에 두는 헤더 (서버가 붙을 때마다 generation 증가)
+// magic 은 나머지 필드를 채운 뒤 마지막에 기록 -> 초기화 도중 죽은 세그먼트는 검증에서 걸러짐
+#define SHM_HEADER_MAGIC 0x314D485331335242ULL // "BR31SHM1" (리틀 엔디언)
+
+struct ShmHeader {
+    uint64_t magic;          // SHM_HEADER_MAGIC
+    uint32_t layout_version; // 세그먼트 구조체별 버전 (필드를 바꾸면 올림)
+    uint32_t layout_size;    // sizeof(세그먼트 구조체)
+    uint64_t generation;     // 1부터, 서버 (재)시작마다 +1 -> 클라이언트가 재시작 감지
+    int32_t owner_pid;       // 현재 붙어 있는 서버 pid
+    uint32_t reserved;
+};
+
+static_assert(sizeof(ShmHeader) == 32, "ShmHeader layout");
+
+inline auto shmGeneration(const ShmHeader& h) -> uint64_t { return __atomic_load_n(&h.generation, __ATOMIC_ACQUIRE); }
+
+// 이동 반영 의도 기록 : 상태 필드를 바꾸기 전에 채우고, 턴 교대(또는 종료)까지 끝나면 지움
+// 서버가 그 사이에 죽으면 재시작 시 pending 인 의도를 끝까지 다시 적용 (같은 결과라 여러 번 적용해도 안전)
+struct MoveIntent {
+    uint32_t pending; // 1 -> 반영 중
+    int32_t player;
+    int32_t from;     // 반영 전 숫자
+    int32_t cnt;
+};
+
+inline auto moveIntentBegin(MoveIntent& m, int player, int from, int cnt) -> void {
+    m.player = player;
+    m.from = from;
+    m.cnt = cnt;
+    __atomic_store_n(&m.pending, 1u, __ATOMIC_RELEASE);
+}
+
+inline auto moveIntentEnd(MoveIntent& m) -> void { __atomic_store_n(&m.pending, 0u, __ATOMIC_RELEASE); }
+
+// 반쯤 반영된 이동을 마저 적용 (Shared : current_num / current_turn / current_cnt / gameover / last_caller / turn_ring / intent)
+// 복구했으면 true
+template <typename Shared>
+auto moveIntentRepair(Shared& d, int maxNum) -> bool {
+    MoveIntent& m = d.intent;
+    if (__atomic_load_n(&m.pending, __ATOMIC_ACQUIRE) == 0) return false;
+    int num = m.from + m.cnt < maxNum ? m.from + m.cnt : maxNum;
+    d.current_num = num;
+    d.current_cnt = m.cnt;
+    if (num >= maxNum) {
+        d.current_turn = m.player;
+        snprintf(d.last_caller, sizeof(d.last_caller), "P%d", m.player);
+        d.gameover = true;
+    } else {
+        d.current_turn = turnRingNext(d.turn_ring, m.player);
+    }
+    moveIntentEnd(m);
+    return true;
+}
+
+// 복구 모드 (--recover 또는 BR31_RECOVER=1), argv 에서 제거
+inline auto recoverRequested(int& argc, char* argv[]) -> bool {
+    const char* env = getenv("BR31_RECOVER");
+    bool recover = env != nullptr && strcmp(env, "1") == 0;
+    int out = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--recover") == 0) recover = true;
+        else argv[out++] = argv[i];
+    }
+    argc = out;
+    argv[argc] = nullptr;
+    return recover;
+}
+
+// 세그먼트를 쥔 서버가 아직 살아 있는지 (종료됐지만 회수되지 않은 좀비는 죽은 것으로 봄)
+inline auto shmOwnerAlive(int pid) -> bool {
+    if (pid <= 0 || pid == getpid() || kill(pid, 0) == -1) return false;
+    char path[64], buf[256];
+    snprintf(path, sizeof(path), "/proc/%d/stat", pid);
+    FILE* f = fopen(path, "r");
+    if (f == nullptr) return true;
+    size_t n = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[n] = '\0';
+    const char* state = strrchr(buf, ')'); // "pid (comm) S ..." (comm 에 공백 / 괄호가 있을 수 있어 마지막 ')' 기준)
+    return state == nullptr || state[1] == '\0' || state[2] != 'Z';
+}
+
+enum class ShmAttach {
+    Failed,
+    Created,    // 새로 초기화 (memset + 헤더)
+    Reattached  // 기존 상태 그대로 재부착
+};
+
+// [ SRP ] 헤더가 붙은 세그먼트 열기 (T 의 첫 멤버는 ShmHeader header)
+// recover : 같은 키의 세그먼트가 크기 / magic / 버전까지 맞고 소유 서버가 죽어 있으면 그대로 재부착
+// 그 밖에는 (크기가 다른 옛 세그먼트는 지우고) 새로 초기화, generation 은 이전 값에서 이어감
+template <typename T>
+auto shmAttach(key_t key, uint32_t version, bool recover, int& shmId, T*& seg) -> ShmAttach {
+    shmId = shmget(key, 0, 0666);
+    if (shmId != -1) {
+        shmid_ds ds{};
+        if (shmctl(shmId, IPC_STAT, &ds) == 0 && ds.shm_segsz != sizeof(T)) {
+            fprintf(stderr, "[ Recover ] 세그먼트 크기 불일치 ( %zu != %zu ) -> 새로 생성\n", (size_t)ds.shm_segsz, sizeof(T));
+            shmctl(shmId, IPC_RMID, nullptr);
+            shmId = -1;
+        }
+    }
+    if (shmId == -1) shmId = shmget(key, sizeof(T), 0666 | IPC_CREAT);
+    if (shmId == -1) { perror("shmget"); return ShmAttach::Failed; }
+    seg = (T*)shmat(shmId, nullptr, 0);
+    if (seg == (void*)-1) { perror("shmat"); seg = nullptr; return ShmAttach::Failed; }
+
+    ShmHeader& h = seg->header;
+    bool valid = h.magic == SHM_HEADER_MAGIC && h.layout_version == version && h.layout_size == sizeof(T);
+    if (recover && valid) {
+        if (shmOwnerAlive(h.owner_pid)) {
+            fprintf(stderr, "[ Recover ] 서버 pid %d 가 아직 세그먼트를 사용 중\n", h.owner_pid);
+            shmdt(seg);
+            seg = nullptr;
+            return ShmAttach::Failed;
+        }
+        h.owner_pid = getpid();
+        __atomic_store_n(&h.generation, h.generation + 1, __ATOMIC_RELEASE);
+        return ShmAttach::Reattached;
+    }
+
+    uint64_t generation = valid ? h.generation + 1 : 1;
+    memset((void*)seg, 0, sizeof(T));
+    h.layout_version = version;
+    h.layout_size = sizeof(T);
+    h.generation = generation;
+    h.owner_pid = getpid();
+    __atomic_store_n(&h.magic, SHM_HEADER_MAGIC, __ATOMIC_RELEASE);
+    return ShmAttach::Created;
+}
@@ -0,0 +1,68 @@
+#pragma once // 공유 메모리 SPSC 링 전송 (클라이언트 1명 = 생산자 1, 서버 수신기 1 = 소비자 1) : sem_server ring / br31_server 공통
+
+#include <atomic>
+#include <cstdint>
+#include "futex.hpp"
+#include "turnRing.hpp"
+#include "turnDoorbell.hpp"
+#include "shmRecovery.hpp"
+#include "instance.hpp"
+
+#define RING_SHM_KEY Instance::key(60015)
+#define RING_SHM_LAYOUT 3      // RingSegment 레이아웃 버전 (2 : 클라이언트용 게임 상태 view 추가, 3 : view 턴 알림 추가)
+#define RING_CAPACITY 1024     // 2의 거듭제곱 (인덱스 마스킹)
+#define RING_PLAYERS MAX_PLAYERS // 링 세그먼트에 들어있는 플레이어별 링 개수
+
+struct RingMove {
+    int32_t player_id;
+    int32_t cnt;
+}; // 링 슬롯 하나
+
+struct ShmRing {
+    alignas(64) std::atomic<uint32_t> head;          // 생산자(클라이언트)만 증가
+    alignas(64) std::atomic<uint32_t> tail;          // 소비자(서버)만 증가
+    alignas(64) std::atomic<uint32_t> consumer_idle; // 1 -> 소비자가 futex 대기 중 (생산자가 깨워야 함)
+    alignas(64) RingMove slots[RING_CAPACITY];
+}; // head/tail/대기 플래그를 캐시 라인별로 분리해 false sharing 방지
+
+// 링 클라이언트가 보는 게임 상태 (서버가 이동을 반영할 때마다 갱신)
+// 링 전송이 자기 클라이언트에 필요한 상태를 직접 실어 보내므로, 서버가 게임 상태를 어떤 세그먼트에 두든 클라이언트는 링 세그먼트만 붙음
+struct RingView {
+    alignas(64) std::atomic<int32_t> number;
+    std::atomic<int32_t> turn;       // 마지막에 release 로 기록 -> turn 을 보고 읽은 number 는 최신
+    std::atomic<uint32_t> gameover;
+    TurnRing turn_ring;              // 시작 시 한 번 기록, 이후 읽기 전용
+    TurnSignal signal;               // 갱신마다 서버가 올림 -> 클라이언트는 폴링 대신 futex 로 턴 / 숫자 변화를 기다림
+};
+
+struct RingSegment {
+    ShmHeader header; // 웜 재시작 검증 (재부착하면 링에 남은 이동도 그대로 이어서 처리)
+    RingView view;
+    ShmRing rings[RING_PLAYERS]; // rings[playerId - 1]
+}; // 링 공유 메모리 구조체
+
+static_assert((RING_CAPACITY & (RING_CAPACITY - 1)) == 0, "RING_CAPACITY must be a power of two");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "ring indices must be lock-free");
+
+// 생산자 측 push (가득 차면 false), 소비자가 잠들어 있을 때만 futex wake 시스템 콜
+inline bool ringPush(ShmRing* ring, const RingMove& mv) {
+    uint32_t head = ring->head.load(std::memory_order_relaxed);
+    if (head - ring->tail.load(std::memory_order_acquire) >= RING_CAPACITY) return false;
+    ring->slots[head & (RING_CAPACITY - 1)] = mv;
+    ring->head.store(head + 1, std::memory_order_release);
+
+    std::atomic_thread_fence(std::memory_order_seq_cst); // head 공개 후 idle 플래그 확인 (소비자의 idle 설정 후 재확인과 짝)
+    if (ring->consumer_idle.load(std::memory_order_relaxed) == 1) {
+        ring->consumer_idle.store(0, std::memory_order_relaxed);
+        futexWake(&ring->consumer_idle, 1);
+    }
+    return true;
+}
+
+// 서버 측 view 갱신 (number / gameover 먼저, turn 을 마지막에 release) 후 기다리는 클라이언트에 알림
+inline void ringViewPublish(RingView& v, int number, int turn, bool over) {
+    v.number.store(number, std::memory_order_relaxed);
+    v.gameover.store(over ? 1u : 0u, std::memory_order_relaxed);
+    v.turn.store(turn, std::memory_order_release);
+    turnSignalRaise(v.signal);
+}
@@ -0,0 +1,203 @@
+#pragma once // 관전 채널 : 서버(쓰기 1) -> 관전 프로세스(읽기 N) 공유 메모리 이벤트 링 (seqlock + futex)
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <pthread.h>
+#include <time.h>
+#include "futex.hpp"
+#include "instance.hpp"
+#include "shmRecovery.hpp"
+
+// 서버별 관전 세그먼트 키 (메트릭 세그먼트처럼 게임 상태 세그먼트와 별도, 인스턴스별)
+#define SPECTATOR_KEY_PIPE Instance::key(60023)
+#define SPECTATOR_KEY_SEM Instance::key(60024)
+#define SPECTATOR_KEY_SERVER Instance::key(60025)
+#define SPECTATOR_LAYOUT 1
+#define SPECTATOR_CAPACITY 4096 // 2의 거듭제곱 (인덱스 마스킹), 읽는 쪽이 이만큼 뒤처지면 건너뜀
+#define SPECTATOR_COALESCE_NS 1000000      // 이벤트를 받은 직후의 첫 대기 (1ms) : 이 동안 futex 대기열에 들어가지 않음
+#define SPECTATOR_COALESCE_MAX_NS 16000000 // 이벤트가 계속 이어지면 대기를 두 배씩 늘려 이 값까지 (관전자당 초당 깨어남 상한)
+
+enum SpectatorEventType : uint32_t {
+    SPEC_START = 1, // 게임 시작 / 서버 (재)시작 시점의 상태 (player = 참가 인원)
+    SPEC_MOVE = 2,  // 이동 반영 + 턴 교대 (turn = 다음 턴)
+    SPEC_OVER = 3   // 게임 종료 (player = 패배자, 0 이면 외부 종료)
+};
+
+struct SpectatorEvent {
+    uint32_t type;   // SpectatorEventType
+    int32_t game;
+    int32_t player;
+    int32_t cnt;
+    int32_t number;  // 반영 후 숫자
+    int32_t turn;    // 반영 후 턴
+    uint64_t ns;     // 발행 시각 (CLOCK_MONOTONIC)
+};
+
+static_assert(sizeof(SpectatorEvent) == 32, "SpectatorEvent is copied as four 64-bit words");
+
+// 슬롯 하나 = seqlock : seq 홀수 -> 쓰는 중, 2 * (이벤트 번호 + 1) -> 그 이벤트가 온전히 기록됨
+// 페이로드도 원자 워드로 읽고 써서 쓰는 도중 읽어도 seq 재확인으로 버림 (데이터 경쟁 없음)
+struct alignas(64) SpectatorSlot {
+    std::atomic<uint64_t> seq;
+    std::atomic<uint64_t> words[4];
+};
+
+struct SpectatorSegment {
+    ShmHeader header;                     // magic / 레이아웃 버전 / 세대 (관전 쪽이 재시작 감지)
+    alignas(64) std::atomic<uint64_t> head; // 발행한 이벤트 수 (쓰는 쪽만 증가)
+    std::atomic<uint32_t> wake_word;        // futex 워드 : 발행마다 +1
+    alignas(64) std::atomic<uint32_t> sleepers; // futex 대기 중인 관전 쪽 수 (쓰는 쪽은 0 이면 wake 생략)
+    std::atomic<uint32_t> relay;                // 1 -> 쓰는 쪽이 한 명만 깨움, 먼저 가져간 관전 쪽이 나머지를 깨움
+    SpectatorSlot slots[SPECTATOR_CAPACITY];
+}; // 관전 공유 메모리 구조체
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "spectator seq must be lock-free in shared memory");
+static_assert((SPECTATOR_CAPACITY & (SPECTATOR_CAPACITY - 1)) == 0, "SPECTATOR_CAPACITY must be a power of two");
+
+inline auto spectatorNowNs() -> uint64_t {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// [ SRP ] 서버 측 발행 (이벤트 하나 = 슬롯 쓰기 + head 공개, 대기 중인 관전 쪽이 있을 때만 한 명 깨우기)
+// 발행 비용은 관전 프로세스 수와 무관 (읽는 쪽은 세그먼트를 직접 읽고, 쓰는 쪽은 누가 읽는지 모름)
+// 잠든 관전 쪽 전체를 깨우는 futex 대기열 순회는 릴레이를 맡은 관전 쪽이 부담
+// 서버 안의 여러 수신 스레드가 발행하면 프로세스 내부 락으로 순서를 정함 (세그먼트 기준 쓰는 쪽은 하나)
+class SpectatorChannel {
+    int shmId = -1;
+    SpectatorSegment* seg = nullptr;
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+public:
+    // 서버 시작마다 새로 초기화 (관전 쪽은 세대 / shmid 변화로 재시작 감지)
+    auto open(key_t key) -> bool {
+        if (shmAttach(key, SPECTATOR_LAYOUT, false, shmId, seg) == ShmAttach::Failed) {
+            seg = nullptr;
+            return false;
+        }
+        return true;
+    }
+
+    auto isOpen() const -> bool { return seg != nullptr; }
+
+    auto publish(const SpectatorEvent& ev) -> void {
+        if (seg == nullptr) return;
+        uint64_t words[4];
+        memcpy(words, &ev, sizeof(words));
+        pthread_mutex_lock(&lock);
+        uint64_t index = seg->head.load(std::memory_order_relaxed);
+        SpectatorSlot& s = seg->slots[index & (SPECTATOR_CAPACITY - 1)];
+        s.seq.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release); // 홀수 seq 가 페이로드보다 먼저 보이게
+        for (int i = 0; i < 4; ++i) s.words[i].store(words[i], std::memory_order_relaxed);
+        s.seq.store(2 * index + 2, std::memory_order_release);
+        seg->head.store(index + 1, std::memory_order_release);
+        seg->wake_word.fetch_add(1, std::memory_order_seq_cst); // 관전 쪽의 sleepers 증가 후 재확인과 짝
+        bool wake = seg->sleepers.load(std::memory_order_seq_cst) > 0;
+        pthread_mutex_unlock(&lock);
+        if (wake) {
+            seg->relay.store(1, std::memory_order_release);
+            futexWake(&seg->wake_word, 1);
+        }
+    }
+
+    auto publish(SpectatorEventType type, int game, int player, int cnt, int number, int turn) -> void {
+        publish(SpectatorEvent{(uint32_t)type, game, player, cnt, number, turn, spectatorNowNs()});
+    }
+
+    // 관전 쪽 대기를 모두 풀기 (서버 종료 시 / 같은 채널을 읽는 서버 내부 스레드 정지)
+    auto wakeAll() -> void {
+        if (seg == nullptr) return;
+        seg->wake_word.fetch_add(1, std::memory_order_seq_cst);
+        futexWake(&seg->wake_word);
+    }
+
+    auto segment() -> SpectatorSegment* { return seg; }
+
+    // 관전 쪽은 붙어 있는 동안 계속 읽을 수 있고, 모두 떨어지면 커널이 회수
+    auto remove() -> void {
+        if (seg == nullptr) return;
+        wakeAll();
+        shmctl(shmId, IPC_RMID, nullptr);
+        shmdt(seg);
+        seg = nullptr;
+    }
+
+    ~SpectatorChannel() { pthread_mutex_destroy(&lock); }
+};
+
+// 관전 쪽 read 결과
+enum class SpectatorRead {
+    Event,  // ev 에 이벤트 하나
+    Empty,  // 새 이벤트 없음
+    Lapped  // 쓰는 쪽이 링을 한 바퀴 넘게 앞섬 -> 남은 가장 오래된 이벤트부터 이어 읽음 (lost 에 건너뛴 수)
+};
+
+// [ SRP ] 관전 측 읽기 (락 없음, 세그먼트에 쓰는 것은 대기할 때의 sleepers 뿐)
+// 이벤트가 이어지는 동안은 futex 대신 짧게 잠든 뒤 모아 읽음 (SPECTATOR_COALESCE_NS 부터 두 배씩, SPECTATOR_COALESCE_MAX_NS 까지)
+// -> 바쁜 동안 sleepers 가 0 이라 쓰는 쪽은 wake 를 생략 (futex 대기열을 훑는 비용이 관전자 수만큼 늘지 않음)
+// -> 관전자 하나의 깨어남은 발행 빈도와 무관하게 초당 수십 번 이하
+// 한가할 때만 futex 로 잠들어 첫 이벤트에 바로 깨어남
+class SpectatorReader {
+    SpectatorSegment* seg = nullptr;
+    uint64_t next = 0;
+    bool busy = false;   // 마지막 대기 이후 이벤트를 읽었는지
+    long napNs = 0;      // 이어지는 동안의 현재 대기 길이 (한가해지면 0)
+public:
+    // fromStart : 링에 남은 가장 오래된 이벤트부터 (아니면 지금 이후 이벤트만)
+    explicit SpectatorReader(SpectatorSegment* s, bool fromStart = false) : seg{s} {
+        uint64_t head = seg->head.load(std::memory_order_acquire);
+        next = !fromStart ? head : head > SPECTATOR_CAPACITY ? head - SPECTATOR_CAPACITY : 0;
+    }
+
+    auto position() const -> uint64_t { return next; }
+
+    auto read(SpectatorEvent& ev, uint64_t& lost) -> SpectatorRead {
+        while (true) {
+            uint64_t head = seg->head.load(std::memory_order_acquire);
+            if (next >= head) return SpectatorRead::Empty;
+            if (head - next > SPECTATOR_CAPACITY) {
+                lost = head - SPECTATOR_CAPACITY - next;
+                next = head - SPECTATOR_CAPACITY;
+                return SpectatorRead::Lapped;
+            }
+            const SpectatorSlot& s = seg->slots[next & (SPECTATOR_CAPACITY - 1)];
+            uint64_t expected = 2 * next + 2;
+            uint64_t before = s.seq.load(std::memory_order_acquire);
+            if (before != expected) continue; // 그 사이 덮어쓰는 중 -> head 부터 다시 판단
+            uint64_t words[4];
+            for (int i = 0; i < 4; ++i) words[i] = s.words[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire); // 페이로드를 읽은 뒤 seq 재확인
+            if (s.seq.load(std::memory_order_relaxed) != before) continue;
+            memcpy(&ev, words, sizeof(ev));
+            ++next;
+            busy = true;
+            return SpectatorRead::Event;
+        }
+    }
+
+    // 새 이벤트가 올 때까지 최대 timeout 대기 (nullptr -> 무기한), 새 이벤트가 있으면 true
+    // 직전에 이벤트를 읽었으면 timeout 과 현재 대기 길이 중 짧은 쪽만 잠듦 (EINTR 이면 일찍 돌아옴)
+    auto wait(const timespec* timeout) -> bool {
+        if (busy) {
+            busy = false;
+            napNs = napNs == 0 ? SPECTATOR_COALESCE_NS : std::min<long>(napNs * 2, SPECTATOR_COALESCE_MAX_NS);
+            timespec nap{0, napNs};
+            if (timeout != nullptr && timeout->tv_sec == 0 && timeout->tv_nsec < nap.tv_nsec) nap = *timeout;
+            nanosleep(&nap, nullptr);
+            return seg->head.load(std::memory_order_acquire) > next;
+        }
+        napNs = 0;
+        seg->sleepers.fetch_add(1, std::memory_order_seq_cst);
+        uint32_t seen = seg->wake_word.load(std::memory_order_seq_cst);
+        if (seg->head.load(std::memory_order_acquire) <= next) futexWait(&seg->wake_word, seen, timeout);
+        seg->sleepers.fetch_sub(1, std::memory_order_seq_cst);
+        // 릴레이 : 대기열에 남은 관전 쪽을 대신 깨움 (깨어난 쪽 하나만 가져가므로 wake 는 한 번)
+        if (seg->relay.load(std::memory_order_relaxed) != 0 && seg->relay.exchange(0, std::memory_order_acq_rel) != 0) {
+            futexWake(&seg->wake_word);
+        }
+        return seg->head.load(std::memory_order_acquire) > next;
+    }
+};
@@ -0,0 +1,53 @@
+#pragma once // 봇 클라이언트용 전략 표 (컴파일 시간에 생성, 조회 O(1) / 할당 없음)
+
+#include <array>
+#include <cstdint>
+
+// [ SRP ] 게임 위치별 최적 수 계산 전담
+// 규칙 : 차례마다 1 ~ MaxPerTurn 개의 숫자를 이어서 외치고, MaxNum 을 외친 플레이어가 패배
+// win[n]  : 현재 숫자가 n 일 때 차례인 플레이어가 (2인 최적 플레이 기준) 이길 수 있는지
+// move[n] : n 에서 외칠 개수 (이기는 수가 있으면 그 수, 없으면 1개만 외쳐 상대 실수를 기다림)
+template <int MaxNum, int MaxPerTurn>
+class StrategyTable {
+    static_assert(MaxNum > 1 && MaxNum <= UINT16_MAX, "MaxNum out of range");
+    static_assert(MaxPerTurn >= 1 && MaxPerTurn <= UINT8_MAX, "MaxPerTurn out of range");
+
+    struct Table {
+        std::array<bool, MaxNum + 1> win{};
+        std::array<uint8_t, MaxNum + 1> move{};
+    };
+
+    // MaxNum 부터 거꾸로 채움 : n 의 결과는 n + 1 ~ n + MaxPerTurn 만 참조
+    static constexpr auto build() -> Table {
+        Table t{};
+        t.win[MaxNum] = true; // 직전 플레이어가 MaxNum 을 외쳐 패배 -> 차례인 쪽이 승리
+        t.move[MaxNum] = 0;
+        for (int n = MaxNum - 1; n >= 0; --n) {
+            t.win[n] = false;
+            t.move[n] = 1;
+            for (int c = 1; c <= MaxPerTurn && n + c < MaxNum; ++c) {
+                if (!t.win[n + c]) {
+                    t.win[n] = true;
+                    t.move[n] = (uint8_t)c;
+                    break;
+                }
+            }
+        }
+        return t;
+    }
+
+    static constexpr Table table = build();
+public:
+    // 범위를 벗어난 숫자는 게임 종료 상태로 취급
+    static constexpr auto isWinning(int number) -> bool {
+        return (number < 0 || number >= MaxNum) ? true : table.win[number];
+    }
+
+    static constexpr auto bestMove(int number) -> int {
+        return (number < 0 || number >= MaxNum) ? 0 : table.move[number];
+    }
+};
+
+// 베스킨라빈스 31 (한 턴 최대 3개) : 2, 6, 10, ..., 30 에서 차례가 오면 패배 위치
+static_assert(StrategyTable<31, 3>::bestMove(0) == 2 && !StrategyTable<31, 3>::isWinning(2), "strategy table self-check");
+static_assert(!StrategyTable<31, 3>::isWinning(30) && StrategyTable<31, 3>::bestMove(27) == 3, "strategy table self-check");
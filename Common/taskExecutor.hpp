@@ -0,0 +1,247 @@
+#pragma once // 서버의 수신기 / 브로드캐스터를 고정 크기 스레드 풀에서 실행하는 executor (CPU 고정, 정지 토큰, 기한 있는 join)
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#include <time.h>
+#include <vector>
+
+// 정지 요청 전달 (requestStop 한 번으로 모든 작업이 관찰, 값은 atomic 이라 시그널 핸들러 / 다른 스레드에서 읽어도 안전)
+class StopToken {
+    const std::atomic<bool>* flag;
+public:
+    explicit StopToken(const std::atomic<bool>* f) : flag{f} {}
+    auto stopRequested() const -> bool { return flag->load(std::memory_order_acquire); }
+};
+
+// 작업 한 번 실행 결과 : Yield -> 큐 뒤에 다시 넣어 다음 차례에 이어서 실행, Done -> 작업 종료
+enum class TaskStep { Yield, Done };
+
+// 워커 수 / CPU 고정 (--threads N, --pin 또는 BR31_THREADS, BR31_PIN=1), argv 에서 제거
+struct ExecutorOptions {
+    int threads = 0;  // 0 -> 작업 수만큼 (작업마다 전용 스레드)
+    bool pin = false; // 워커 i 를 허용된 CPU 중 i 번째(순환)에 고정
+
+    auto configure(int& argc, char* argv[]) -> bool {
+        if (const char* env = getenv("BR31_THREADS")) threads = atoi(env);
+        if (const char* env = getenv("BR31_PIN")) pin = strcmp(env, "1") == 0;
+        int out = 1;
+        for (int i = 1; i < argc; ++i) {
+            if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) threads = atoi(argv[++i]);
+            else if (strcmp(argv[i], "--pin") == 0) pin = true;
+            else argv[out++] = argv[i];
+        }
+        argc = out;
+        argv[argc] = nullptr;
+        return threads >= 0;
+    }
+};
+
+// [ SRP ] 작업 실행 / 종료 관리 전담
+// 작업 = step 함수 (+ 대기 중인 step 을 깨우는 wake 함수), 워커는 큐에서 작업을 꺼내 step 한 번 실행 후 Yield 면 다시 큐에 넣음
+// -> 작업이 워커보다 많아도 step 이 제한 시간 안에 돌아오면 모든 작업이 차례로 진행
+// 한 작업은 한 번에 워커 하나만 실행 (큐 락으로 넘겨받아 작업 내부 상태는 단일 스레드처럼 다룸)
+// 정지 요청 후에는 다시 큐에 넣지 않음 -> 모든 작업이 마지막 step 을 마치면 워커 종료
+class TaskExecutor {
+public:
+    using Step = std::function<TaskStep(const StopToken&)>;
+    using Wake = std::function<void()>;
+private:
+    struct Task {
+        std::string name;
+        Step step;
+        Wake wake;
+        bool running = false;
+    };
+
+    struct alignas(64) Worker {
+        TaskExecutor* pool = nullptr;
+        int index = 0;
+        pthread_t thread{};
+        bool joinable = false; // pthread_create 성공 후 아직 join / detach 전
+        bool exited = false;
+    };
+
+    ExecutorOptions opt;
+    std::atomic<bool> stopFlag{false};
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t ready;        // 큐에 작업 추가 / 정지 요청
+    pthread_cond_t workerExited; // 워커 하나 종료 (CLOCK_MONOTONIC 기준 기한 대기)
+    std::deque<Task*> queue;
+    std::vector<std::unique_ptr<Task>> tasks;
+    std::vector<Worker> workers;
+    int live = 0;                // 아직 종료하지 않은 워커 수
+    bool started = false;
+
+    static void* workerThread(void* arg) {
+        Worker* w = reinterpret_cast<Worker*>(arg);
+        w->pool->workerLoop(*w);
+        return nullptr;
+    }
+
+    auto workerLoop(Worker& self) -> void {
+        StopToken token(&stopFlag);
+        pthread_mutex_lock(&lock);
+        while (true) {
+            while (queue.empty() && !token.stopRequested()) pthread_cond_wait(&ready, &lock);
+            if (queue.empty()) break; // 정지 요청 후에도 큐에 남은(양보한) 작업은 step 한 번 더 (토큰을 보고 정리 후 Done)
+            Task* t = queue.front();
+            queue.pop_front();
+            t->running = true;
+            pthread_mutex_unlock(&lock);
+
+            TaskStep r = t->step(token);
+
+            pthread_mutex_lock(&lock);
+            t->running = false;
+            if (r == TaskStep::Yield && !token.stopRequested()) {
+                queue.push_back(t);
+                pthread_cond_signal(&ready);
+            }
+        }
+        self.exited = true;
+        --live;
+        pthread_cond_broadcast(&workerExited);
+        pthread_mutex_unlock(&lock);
+    }
+
+    // 워커 i 에 줄 CPU (프로세스에 허용된 CPU 중 i 번째, 순환)
+    static auto cpuFor(int i, const cpu_set_t& allowed) -> int {
+        int n = CPU_COUNT(&allowed);
+        if (n == 0) return -1;
+        int want = i % n;
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &allowed) && want-- == 0) return cpu;
+        }
+        return -1;
+    }
+
+public:
+    explicit TaskExecutor(const ExecutorOptions& o = ExecutorOptions{}) : opt{o} {
+        pthread_cond_init(&ready, nullptr);
+        pthread_condattr_t attr;
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_cond_init(&workerExited, &attr);
+        pthread_condattr_destroy(&attr);
+    }
+
+    TaskExecutor(const TaskExecutor&) = delete;
+    TaskExecutor& operator=(const TaskExecutor&) = delete;
+
+    ~TaskExecutor() {
+        if (started && live > 0) joinFor(1000);
+        if (live > 0) return; // 기한 안에 끝나지 않은 워커가 아직 이 객체를 참조 -> 동기화 객체는 남겨 둠 (곧 프로세스 종료)
+        pthread_cond_destroy(&ready);
+        pthread_cond_destroy(&workerExited);
+        pthread_mutex_destroy(&lock);
+    }
+
+    // 워커 생성 (expectedTasks : 스레드 수 미지정 시 작업마다 전용 스레드, 지정 값도 작업 수를 넘지 않음)
+    auto start(int expectedTasks) -> int {
+        int n = opt.threads > 0 ? opt.threads : expectedTasks;
+        if (expectedTasks > 0 && n > expectedTasks) n = expectedTasks;
+        if (n < 1) n = 1;
+
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (opt.pin && sched_getaffinity(0, sizeof(allowed), &allowed) != 0) CPU_ZERO(&allowed);
+
+        workers.resize(n);
+        pthread_mutex_lock(&lock);
+        for (int i = 0; i < n; ++i) {
+            Worker& w = workers[i];
+            w.pool = this;
+            w.index = i;
+            pthread_attr_t attr;
+            pthread_attr_init(&attr);
+            int cpu = opt.pin ? cpuFor(i, allowed) : -1;
+            if (cpu >= 0) {
+                cpu_set_t one;
+                CPU_ZERO(&one);
+                CPU_SET(cpu, &one);
+                pthread_attr_setaffinity_np(&attr, sizeof(one), &one);
+            }
+            if (pthread_create(&w.thread, &attr, workerThread, &w) == 0) {
+                w.joinable = true;
+                ++live;
+                char name[16];
+                snprintf(name, sizeof(name), "br31-w%d", i % 1000);
+                pthread_setname_np(w.thread, name);
+            }
+            pthread_attr_destroy(&attr);
+        }
+        started = true;
+        pthread_mutex_unlock(&lock);
+        return live;
+    }
+
+    auto submit(const std::string& name, Step step, Wake wake = nullptr) -> void {
+        pthread_mutex_lock(&lock);
+        tasks.push_back(std::make_unique<Task>(Task{name, std::move(step), std::move(wake)}));
+        queue.push_back(tasks.back().get());
+        pthread_cond_signal(&ready);
+        pthread_mutex_unlock(&lock);
+    }
+
+    auto size() const -> int { return (int)workers.size(); }
+    auto token() const -> StopToken { return StopToken(&stopFlag); }
+
+    // 정지 요청 : 토큰 설정 후 모든 작업의 wake 호출 (블록된 step 이 바로 돌아오게)
+    auto requestStop() -> void {
+        pthread_mutex_lock(&lock);
+        stopFlag.store(true, std::memory_order_release);
+        pthread_cond_broadcast(&ready);
+        pthread_mutex_unlock(&lock);
+        for (auto& t : tasks) {
+            if (t->wake) t->wake();
+        }
+    }
+
+    // 정지 요청 후 deadlineMs 안에 모든 워커 join, 기한을 넘기면 남은 작업 이름을 stderr 에 남기고 false
+    // (남은 워커는 분리, 호출한 쪽은 곧 종료해야 함)
+    auto joinFor(int deadlineMs) -> bool {
+        requestStop();
+        timespec deadline{};
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += deadlineMs / 1000;
+        deadline.tv_nsec += (long)(deadlineMs % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        pthread_mutex_lock(&lock);
+        while (live > 0) {
+            if (pthread_cond_timedwait(&workerExited, &lock, &deadline) == ETIMEDOUT) break;
+        }
+        bool all = live == 0;
+        if (!all) {
+            for (auto& t : tasks) {
+                if (t->running) fprintf(stderr, "[ Executor ] 기한 %dms 안에 끝나지 않은 작업 : %s\n", deadlineMs, t->name.c_str());
+            }
+        }
+        std::vector<bool> done(workers.size());
+        for (size_t i = 0; i < workers.size(); ++i) done[i] = workers[i].exited;
+        pthread_mutex_unlock(&lock);
+
+        for (size_t i = 0; i < workers.size(); ++i) {
+            Worker& w = workers[i];
+            if (!w.joinable) continue;
+            if (done[i]) pthread_join(w.thread, nullptr);
+            else pthread_detach(w.thread);
+            w.joinable = false;
+        }
+        started = false;
+        return all;
+    }
+};
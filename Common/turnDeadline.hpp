@@ -0,0 +1,219 @@
+#pragma once // 턴 기한 : 게임별 턴 마감 시각 큐 + timerfd (기한 안에 이동하지 않은 턴을 서버가 대신 끝냄)
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <pthread.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+// 기한이 지난 턴의 처리 (--on-timeout)
+enum class TurnTimeout {
+    Forfeit, // 턴 주인의 기권 패로 게임 종료 (forfeit)
+    AutoMove // 서버가 전략 표의 수로 대신 이동 (move)
+};
+
+// 실행 인자 : --turn-timeout 초 (0 -> 기한 없음) --on-timeout forfeit|move
+// 환경 변수 BR31_TURN_TIMEOUT / BR31_ON_TIMEOUT 를 먼저 적용, 인자는 argv 에서 제거
+struct DeadlineOptions {
+    double seconds = 30.0;
+    TurnTimeout policy = TurnTimeout::Forfeit;
+
+    auto configure(int& argc, char* argv[]) -> bool {
+        const char* sec = getenv("BR31_TURN_TIMEOUT");
+        const char* on = getenv("BR31_ON_TIMEOUT");
+        int out = 1;
+        for (int i = 1; i < argc; ++i) {
+            if (strcmp(argv[i], "--turn-timeout") == 0 && i + 1 < argc) sec = argv[++i];
+            else if (strcmp(argv[i], "--on-timeout") == 0 && i + 1 < argc) on = argv[++i];
+            else argv[out++] = argv[i];
+        }
+        argc = out;
+        argv[argc] = nullptr;
+
+        if (sec != nullptr) {
+            char* end = nullptr;
+            seconds = strtod(sec, &end);
+            if (end == sec || *end != '\0' || seconds < 0) return false;
+        }
+        if (on == nullptr || strcmp(on, "forfeit") == 0) policy = TurnTimeout::Forfeit;
+        else if (strcmp(on, "move") == 0) policy = TurnTimeout::AutoMove;
+        else return false;
+        return true;
+    }
+
+    auto timeoutNs() const -> uint64_t { return (uint64_t)(seconds * 1e9); }
+    auto policyName() const -> const char* { return policy == TurnTimeout::Forfeit ? "forfeit" : "move"; }
+};
+
+// [ SRP ] 게임별 턴 기한 관리 (기한 걸기 / 풀기 / 만료된 게임 꺼내기)
+// 모든 턴의 기한 길이가 같으므로 새로 거는 기한은 항상 가장 늦음 -> 기한 순 큐 = 이중 연결 리스트 끝에 붙이기
+// 걸기 / 풀기 / 꺼내기 모두 O(1) (게임 수와 무관, 힙이나 타이머 휠이 필요 없음), 노드는 게임 id 로 인덱싱하는 배열
+// timerfd 는 큐 맨 앞 기한에만 맞춤 : 뒤에 붙이는 걸기는 맨 앞을 앞당기지 않으므로 이동마다 timerfd_settime 하지 않음
+// (맨 앞 게임이 그 사이 이동했으면 한 번 헛되이 깨어난 뒤 새 맨 앞에 다시 맞춤)
+// 여러 수신 스레드가 걸고 푸는 서버(br31_server)도 있어 큐는 내부 락으로 보호, 만료 처리 콜백은 락 밖에서 호출
+class TurnDeadlines {
+    struct Node {
+        uint64_t due = 0; // 마감 시각 (CLOCK_MONOTONIC ns)
+        int prev = -1;
+        int next = -1;
+        bool armed = false;
+    };
+    std::vector<Node> nodes;
+    std::vector<int> fired;
+    int head = -1;
+    int tail = -1;
+    uint64_t timeoutNs = 0;
+    int timerFd = -1;
+    uint64_t timerDue = 0; // timerfd 가 맞춰진 시각 (0 -> 해제 / 이미 울림)
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+    static auto nowNs() -> uint64_t {
+        timespec ts{};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    }
+
+    auto unlink(int id) -> void {
+        Node& n = nodes[id];
+        if (n.prev != -1) nodes[n.prev].next = n.next;
+        else head = n.next;
+        if (n.next != -1) nodes[n.next].prev = n.prev;
+        else tail = n.prev;
+        n.prev = n.next = -1;
+        n.armed = false;
+    }
+
+    auto append(int id) -> void {
+        Node& n = nodes[id];
+        n.due = nowNs() + timeoutNs;
+        n.prev = tail;
+        n.next = -1;
+        n.armed = true;
+        if (tail != -1) nodes[tail].next = id;
+        else head = id;
+        tail = id;
+    }
+
+    // 맨 앞 기한이 timerfd 보다 이르면 (해제 상태 포함) 다시 맞춤
+    auto settle() -> void {
+        if (timerFd == -1 || head == -1) return;
+        uint64_t due = nodes[head].due;
+        if (timerDue != 0 && timerDue <= due) return;
+        itimerspec its{};
+        its.it_value.tv_sec = (time_t)(due / 1000000000ULL);
+        its.it_value.tv_nsec = (long)(due % 1000000000ULL);
+        if (timerfd_settime(timerFd, TFD_TIMER_ABSTIME, &its, nullptr) == 0) timerDue = due;
+    }
+public:
+    // games : 게임 슬롯 수, timeout == 0 -> 기한 없음 (모든 호출이 아무 일도 하지 않음)
+    // withTimer : epoll 로 기다리는 서버는 fd() 를 등록, 아니면 untilNext 로 대기 시간을 정함
+    auto open(int games, uint64_t timeout, bool withTimer) -> bool {
+        timeoutNs = timeout;
+        if (timeoutNs == 0) return true;
+        nodes.assign(games, Node{});
+        fired.reserve(games);
+        if (withTimer) {
+            timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+            if (timerFd == -1) {
+                perror("timerfd_create");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto enabled() const -> bool { return timeoutNs > 0; }
+    auto fd() const -> int { return timerFd; }
+
+    // 지금부터 새 기한 (이동이 반영될 때마다, 이미 걸려 있으면 맨 뒤로 옮김)
+    auto arm(int id) -> void {
+        if (!enabled()) return;
+        pthread_mutex_lock(&lock);
+        if (nodes[id].armed) unlink(id);
+        append(id);
+        settle();
+        pthread_mutex_unlock(&lock);
+    }
+
+    // 걸려 있지 않을 때만 기한 시작 (플레이어 연결 시, 기존 기한은 늘리지 않음)
+    auto start(int id) -> void {
+        if (!enabled()) return;
+        pthread_mutex_lock(&lock);
+        if (!nodes[id].armed) {
+            append(id);
+            settle();
+        }
+        pthread_mutex_unlock(&lock);
+    }
+
+    auto cancel(int id) -> void {
+        if (!enabled()) return;
+        pthread_mutex_lock(&lock);
+        if (nodes[id].armed) unlink(id);
+        pthread_mutex_unlock(&lock);
+    }
+
+    auto armed(int id) -> bool {
+        if (!enabled()) return false;
+        pthread_mutex_lock(&lock);
+        bool a = nodes[id].armed;
+        pthread_mutex_unlock(&lock);
+        return a;
+    }
+
+    // 가장 이른 기한이 지났는지 (시스템 콜 없음 : 입력이 끊이지 않아 타이머 대기까지 가지 않는 루프가 배치마다 확인)
+    auto overdue() -> bool {
+        if (!enabled()) return false;
+        pthread_mutex_lock(&lock);
+        bool late = head != -1 && nodes[head].due <= nowNs();
+        pthread_mutex_unlock(&lock);
+        return late;
+    }
+
+    // 가장 이른 기한까지 남은 시간을 cap 과 비교해 짧은 쪽 (futex 등 timeout 인자로 기다리는 서버용)
+    auto untilNext(timespec cap) -> timespec {
+        if (!enabled()) return cap;
+        pthread_mutex_lock(&lock);
+        uint64_t due = head != -1 ? nodes[head].due : 0;
+        pthread_mutex_unlock(&lock);
+        if (due == 0) return cap;
+        uint64_t now = nowNs();
+        uint64_t left = due > now ? due - now : 0;
+        uint64_t capNs = (uint64_t)cap.tv_sec * 1000000000ULL + (uint64_t)cap.tv_nsec;
+        if (left >= capNs) return cap;
+        return timespec{(time_t)(left / 1000000000ULL), (long)(left % 1000000000ULL)};
+    }
+
+    // 기한이 지난 게임을 큐에서 빼고 onExpired(게임 id) 호출 (락 밖, 콜백 안에서 arm / cancel 가능), 처리한 수 반환
+    // timerfd 가 울렸으면 읽어서 비우고 남은 맨 앞 기한에 다시 맞춤
+    template <typename F>
+    auto expire(F onExpired) -> int {
+        if (!enabled()) return 0;
+        if (timerFd != -1) {
+            uint64_t ticks = 0;
+            (void)!read(timerFd, &ticks, sizeof(ticks));
+        }
+        pthread_mutex_lock(&lock);
+        uint64_t now = nowNs();
+        fired.clear();
+        while (head != -1 && nodes[head].due <= now) {
+            fired.push_back(head);
+            unlink(head);
+        }
+        if (timerDue != 0 && timerDue <= now) timerDue = 0;
+        settle();
+        pthread_mutex_unlock(&lock);
+        for (int id : fired) onExpired(id);
+        return (int)fired.size();
+    }
+
+    ~TurnDeadlines() {
+        if (timerFd != -1) close(timerFd);
+        pthread_mutex_destroy(&lock);
+    }
+};
@@ -0,0 +1,103 @@
+#pragma once // 턴 초인종 : 공유 메모리 안의 플레이어별 futex 워드로 턴 인계 (SysV 세마포어 P / V 대체) + 게임별 턴 알림
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include "futex.hpp"
+#include "turnRing.hpp"
+
+// 초인종 하나 = 세마포어 멤버 하나 : tokens 는 울린 뒤 아직 가져가지 않은 횟수
+// 경합 없는 경로는 원자 연산뿐 (울리기 = fetch_add, 가져가기 = CAS), 시스템 콜은 잠들 때 / 잠든 쪽을 깨울 때만
+// 울리는 쪽과 잠드는 쪽은 tokens / waiters 를 서로 반대 순서로 (seq_cst) 쓰고 읽음 -> 적어도 한쪽은 상대의 쓰기를 봄
+struct DoorbellSlot {
+    std::atomic<uint32_t> tokens;
+    std::atomic<uint32_t> waiters; // FUTEX_WAIT 중이거나 들어가려는 쪽 수 (0 이면 울리는 쪽은 wake 생략)
+};
+
+// 플레이어 id 1 ~ MAX_PLAYERS (slots[0] 미사용, 세마포어 멤버 playerId - 1 과 같은 대응)
+struct DoorbellSet {
+    std::atomic<uint32_t> closed; // 1 -> 게임 종료 / 서버 정리, 대기 중인 쪽은 모두 Closed 로 돌아옴
+    DoorbellSlot slots[MAX_PLAYERS + 1];
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "doorbell words must be lock-free in shared memory");
+
+enum class DoorbellTake {
+    Taken,    // 토큰 하나를 가져감 (내 차례 신호)
+    TimedOut, // timeout 안에 울리지 않음
+    Closed    // 초인종이 닫힘 (세마포어의 EIDRM 에 해당)
+};
+
+// 울리기 (세마포어 V) : 잠든 쪽이 있을 때만 FUTEX_WAKE 한 번, 시스템 콜을 했으면 true
+inline auto doorbellRing(DoorbellSet& set, int playerId) -> bool {
+    DoorbellSlot& s = set.slots[playerId];
+    s.tokens.fetch_add(1, std::memory_order_seq_cst);
+    if (s.waiters.load(std::memory_order_seq_cst) == 0) return false;
+    futexWake(&s.tokens, 1);
+    return true;
+}
+
+// 가져가기 (세마포어 P) : 토큰이 있으면 CAS 로 바로, 없으면 FUTEX_WAIT (timeout == nullptr -> 무기한)
+// syscalls 가 있으면 FUTEX_WAIT 호출 수를 더함 (벤치 / 메트릭용)
+inline auto doorbellTake(DoorbellSet& set, int playerId, const timespec* timeout = nullptr, uint64_t* syscalls = nullptr) -> DoorbellTake {
+    DoorbellSlot& s = set.slots[playerId];
+    while (true) {
+        uint32_t v = s.tokens.load(std::memory_order_acquire);
+        while (v > 0) {
+            if (s.tokens.compare_exchange_weak(v, v - 1, std::memory_order_acq_rel, std::memory_order_acquire)) return DoorbellTake::Taken;
+        }
+        if (set.closed.load(std::memory_order_acquire) != 0) return DoorbellTake::Closed;
+
+        s.waiters.fetch_add(1, std::memory_order_seq_cst);
+        int rc = 0;
+        if (s.tokens.load(std::memory_order_seq_cst) == 0 && set.closed.load(std::memory_order_seq_cst) == 0) {
+            rc = futexWait(&s.tokens, 0, timeout);
+            if (syscalls != nullptr) ++*syscalls;
+        }
+        int err = errno;
+        s.waiters.fetch_sub(1, std::memory_order_seq_cst);
+        if (rc == -1 && err == ETIMEDOUT) return DoorbellTake::TimedOut;
+    }
+}
+
+// 닫기 : 이후 가져가기는 토큰이 남아 있지 않으면 Closed, 잠든 쪽은 모두 깨움
+inline auto doorbellClose(DoorbellSet& set) -> void {
+    set.closed.store(1, std::memory_order_seq_cst);
+    for (DoorbellSlot& s : set.slots) {
+        if (s.waiters.load(std::memory_order_seq_cst) > 0) futexWake(&s.tokens);
+    }
+}
+
+// 턴 알림 : 게임 하나의 턴 / 종료가 바뀔 때마다 seq + 1, 기다리는 쪽(그 게임의 모든 플레이어)은 seq 가 바뀔 때까지 잠듦
+// 초인종과 달리 토큰을 가져가지 않음 -> 깨어난 쪽이 턴을 다시 읽어 자기 차례인지 판단 (Pipe 게임 슬롯 / Sem 세그먼트 / 링 view)
+struct TurnSignal {
+    std::atomic<uint32_t> seq;
+    std::atomic<uint32_t> waiters; // 0 이면 알리는 쪽은 wake 생략
+};
+
+// 알리기 : 상태를 쓴 뒤 호출, 잠든 쪽이 있을 때만 FUTEX_WAKE (모두), 시스템 콜을 했으면 true
+inline auto turnSignalRaise(TurnSignal& s) -> bool {
+    s.seq.fetch_add(1, std::memory_order_seq_cst);
+    if (s.waiters.load(std::memory_order_seq_cst) == 0) return false;
+    futexWake(&s.seq);
+    return true;
+}
+
+// seq 를 읽고 (acquire) 상태를 확인한 뒤 호출 -> 그 사이 알림이 있었으면 잠들지 않고 바로 반환
+// timeout 이나 시그널(EINTR)로도 돌아오므로 호출하는 쪽이 상태를 다시 확인
+inline auto turnSignalWait(TurnSignal& s, uint32_t seen, const timespec* timeout) -> void {
+    s.waiters.fetch_add(1, std::memory_order_seq_cst);
+    if (s.seq.load(std::memory_order_seq_cst) == seen) futexWait(&s.seq, seen, timeout);
+    s.waiters.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+// 조건이 참이 될 때까지 알림으로 잠듦 (seq 를 먼저 읽고 조건 확인 -> 그 사이 알림이 있었으면 잠들지 않음)
+// recheck : 잠드는 한 번의 최대 길이 (알리는 쪽이 죽어도 조건을 다시 확인)
+template <typename Done>
+inline auto turnSignalAwait(TurnSignal& s, Done done, const timespec* recheck) -> void {
+    while (true) {
+        uint32_t seen = s.seq.load(std::memory_order_acquire);
+        if (done()) return;
+        turnSignalWait(s, seen, recheck);
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once // 게임 하나의 턴 순서 (N인 플레이, 공유 메모리에 그대로 올라가는 고정 크기 구조체)
+
+#include <cstdint>
+
+#define MAX_PLAYERS 64 // 게임 하나의 최대 참가 인원 (플레이어 id 1 ~ MAX_PLAYERS)
+
+// [ SRP ] 턴 순서 링 : next[p] 가 p 다음 차례 플레이어
+// 턴 교대는 배열 조회 한 번 (O(1)), 플레이어 수와 무관 / 포인터가 없어 프로세스 간 공유 가능
+struct TurnRing {
+    uint8_t players;                // 참가 플레이어 수 (2 ~ MAX_PLAYERS)
+    uint8_t next[MAX_PLAYERS + 1];  // 1-based, next[0] 미사용
+};
+
+// 1 -> 2 -> ... -> players -> 1 순서로 초기화, 범위를 벗어나면 false
+inline auto turnRingInit(TurnRing& ring, int players) -> bool {
+    if (players < 2 || players > MAX_PLAYERS) return false;
+    ring.players = (uint8_t)players;
+    ring.next[0] = 0;
+    for (int p = 1; p <= players; ++p) ring.next[p] = (uint8_t)(p == players ? 1 : p + 1);
+    for (int p = players + 1; p <= MAX_PLAYERS; ++p) ring.next[p] = 0;
+    return true;
+}
+
+inline auto turnRingHas(const TurnRing& ring, int player) -> bool {
+    return player >= 1 && player <= ring.players;
+}
+
+inline auto turnRingNext(const TurnRing& ring, int player) -> int {
+    return ring.next[player];
+}
@@ -0,0 +1,269 @@
+#pragma once // br31_server io_uring 수신 백엔드용 최소 래퍼 (liburing 없이 linux/io_uring.h + raw syscall)
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+// 시스템 헤더가 6.7 이전이어도 쓸 수 있게 번호로 지정 (실행 중인 커널 지원 여부는 uringSupported 로 확인)
+static constexpr uint8_t URING_OP_READ_MULTISHOT = 49; // linux 6.7+ : 버퍼 그룹에서 버퍼를 골라 읽기를 계속 반복
+
+inline int uringSetup(unsigned entries, io_uring_params* p) { return (int)syscall(__NR_io_uring_setup, entries, p); }
+
+inline int uringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags, const void* arg, size_t argSize) {
+    return (int)syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize);
+}
+
+inline int uringRegister(int fd, unsigned op, const void* arg, unsigned nrArgs) {
+    return (int)syscall(__NR_io_uring_register, fd, op, arg, nrArgs);
+}
+
+// user_data 인코딩 : 하위 8비트 종류 | 8 ~ 39 fd (또는 슬롯 번호) | 상위 24비트 세대 (fd 재사용 뒤 늦게 도착한 완료를 구분)
+inline auto uringTag(uint8_t kind, uint32_t index, uint32_t gen = 0) -> uint64_t {
+    return (uint64_t)kind | ((uint64_t)index << 8) | ((uint64_t)(gen & 0xffffff) << 40);
+}
+inline auto uringTagKind(uint64_t tag) -> uint8_t { return (uint8_t)(tag & 0xff); }
+inline auto uringTagIndex(uint64_t tag) -> uint32_t { return (uint32_t)(tag >> 8); }
+inline auto uringTagGen(uint64_t tag) -> uint32_t { return (uint32_t)(tag >> 40); }
+
+// [ SRP ] 제출 / 완료 큐 한 쌍 (스레드 하나가 제출과 완료 처리를 모두 맡는 용도, 스레드 간 공유 안 함)
+class UringQueue {
+    int ringFd = -1;
+    void* sqMap = MAP_FAILED;
+    void* cqMap = MAP_FAILED;
+    size_t sqMapSize = 0;
+    size_t cqMapSize = 0;
+    io_uring_sqe* sqes = (io_uring_sqe*)MAP_FAILED;
+    size_t sqesSize = 0;
+
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned sqMask = 0;
+    unsigned sqEntries = 0;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    unsigned cqMask = 0;
+    io_uring_cqe* cqes = nullptr;
+
+    unsigned localTail = 0; // 채웠지만 아직 커널에 알리지 않은 SQE 까지
+    unsigned submitted = 0; // 커널에 넘긴 SQE 까지
+    uint64_t enters = 0;
+public:
+    // entries : 제출 큐 크기, cqEntries : 완료 큐 크기 (멀티샷 완료가 몰려도 넘치지 않게 크게)
+    auto open(unsigned entries, unsigned cqEntries) -> bool {
+        io_uring_params p{};
+        p.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SUBMIT_ALL | IORING_SETUP_COOP_TASKRUN;
+        p.cq_entries = cqEntries;
+        ringFd = uringSetup(entries, &p);
+        if (ringFd == -1 && errno == EINVAL) { // 5.19 이전 커널 : 선택 플래그 없이 다시
+            p = io_uring_params{};
+            p.flags = IORING_SETUP_CQSIZE;
+            p.cq_entries = cqEntries;
+            ringFd = uringSetup(entries, &p);
+        }
+        if (ringFd == -1) return false;
+        if (!(p.features & IORING_FEAT_EXT_ARG)) return false; // 대기 제한 시간을 enter 인자로 넘김
+
+        sqMapSize = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        cqMapSize = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+        bool single = p.features & IORING_FEAT_SINGLE_MMAP;
+        if (single && cqMapSize > sqMapSize) sqMapSize = cqMapSize;
+        sqMap = mmap(nullptr, sqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+        if (sqMap == MAP_FAILED) return false;
+        cqMap = single ? sqMap : mmap(nullptr, cqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+        if (cqMap == MAP_FAILED) return false;
+        sqesSize = p.sq_entries * sizeof(io_uring_sqe);
+        sqes = (io_uring_sqe*)mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) return false;
+
+        char* sq = (char*)sqMap;
+        sqHead = (unsigned*)(sq + p.sq_off.head);
+        sqTail = (unsigned*)(sq + p.sq_off.tail);
+        sqMask = *(unsigned*)(sq + p.sq_off.ring_mask);
+        sqEntries = p.sq_entries;
+        unsigned* array = (unsigned*)(sq + p.sq_off.array);
+        for (unsigned i = 0; i < sqEntries; ++i) array[i] = i; // SQE 슬롯 = 배열 위치 (고정)
+        char* cq = (char*)cqMap;
+        cqHead = (unsigned*)(cq + p.cq_off.head);
+        cqTail = (unsigned*)(cq + p.cq_off.tail);
+        cqMask = *(unsigned*)(cq + p.cq_off.ring_mask);
+        cqes = (io_uring_cqe*)(cq + p.cq_off.cqes);
+        localTail = submitted = *sqTail;
+        return true;
+    }
+
+    auto fd() const -> int { return ringFd; }
+    auto enterCount() const -> uint64_t { return enters; } // io_uring_enter 호출 수 (메트릭용)
+    auto pending() const -> unsigned { return localTail - submitted; }
+
+    // 빈 SQE 하나 (0 으로 채움), 제출 큐가 가득 차면 먼저 커널에 넘김
+    auto sqe() -> io_uring_sqe* {
+        if (localTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= sqEntries) submit(0, 0);
+        io_uring_sqe* s = &sqes[localTail & sqMask];
+        memset(s, 0, sizeof(*s));
+        ++localTail;
+        return s;
+    }
+
+    // 채운 SQE 제출 + 완료 minComplete 개까지 대기 (timeoutNs 0 -> 무기한), 시스템 콜 한 번
+    // 반환 : 제출한 SQE 수 (제출이 있었으면 대기가 중단돼도 성공), 제출 없이 대기만 중단되면 -ETIME / -EINTR, 그 외 -errno
+    auto submit(unsigned minComplete, uint64_t timeoutNs) -> int {
+        __atomic_store_n(sqTail, localTail, __ATOMIC_RELEASE);
+        unsigned toSubmit = localTail - submitted;
+        __kernel_timespec ts{(long long)(timeoutNs / 1000000000ULL), (long long)(timeoutNs % 1000000000ULL)};
+        io_uring_getevents_arg arg{};
+        arg.ts = timeoutNs > 0 ? (uint64_t)(uintptr_t)&ts : 0;
+        unsigned flags = minComplete > 0 ? IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG : IORING_ENTER_EXT_ARG;
+        ++enters;
+        int r = uringEnter(ringFd, toSubmit, minComplete, flags, &arg, sizeof(arg));
+        if (r < 0) return -errno;
+        submitted += (unsigned)r;
+        return r;
+    }
+
+    // 도착한 완료를 모두 처리 (f(const io_uring_cqe&)), 처리한 개수 반환
+    template <typename F>
+    auto drain(F f) -> unsigned {
+        unsigned head = *cqHead;
+        unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+        unsigned n = 0;
+        while (head != tail) {
+            f(cqes[head & cqMask]);
+            ++head;
+            ++n;
+            if (head == tail) tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+        }
+        __atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+        return n;
+    }
+
+    ~UringQueue() {
+        if (sqes != MAP_FAILED) munmap(sqes, sqesSize);
+        if (cqMap != MAP_FAILED && cqMap != sqMap) munmap(cqMap, cqMapSize);
+        if (sqMap != MAP_FAILED) munmap(sqMap, sqMapSize);
+        if (ringFd != -1) close(ringFd); // 진행 중인 멀티샷 요청은 커널이 취소
+    }
+};
+
+// [ SRP ] 커널에 등록한 제공 버퍼 링 (IORING_REGISTER_PBUF_RING)
+// 수신 요청은 버퍼 없이 제출하고 커널이 도착 시점에 이 그룹에서 버퍼를 골라 채움 -> 연결 수만큼 버퍼를 미리 잡지 않음
+// 완료를 처리한 버퍼는 put 으로 모았다가 publish 한 번으로 링에 되돌림
+class UringBufRing {
+    io_uring_buf_ring* ring = (io_uring_buf_ring*)MAP_FAILED;
+    size_t ringSize = 0;
+    char* data = (char*)MAP_FAILED;
+    size_t dataSize = 0;
+    unsigned entries = 0;
+    unsigned mask = 0;
+    unsigned bufSize = 0;
+    uint16_t tail = 0;
+    uint16_t group = 0;
+public:
+    // entries : 2의 거듭제곱 (최대 32768)
+    auto open(UringQueue& q, uint16_t bgid, unsigned count, unsigned size) -> bool {
+        entries = count;
+        mask = count - 1;
+        bufSize = size;
+        group = bgid;
+        ringSize = entries * sizeof(io_uring_buf);
+        ring = (io_uring_buf_ring*)mmap(nullptr, ringSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+        if (ring == MAP_FAILED) return false;
+        dataSize = (size_t)entries * bufSize;
+        data = (char*)mmap(nullptr, dataSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+        if (data == MAP_FAILED) return false;
+
+        io_uring_buf_reg reg{};
+        reg.ring_addr = (uint64_t)(uintptr_t)ring;
+        reg.ring_entries = entries;
+        reg.bgid = bgid;
+        if (uringRegister(q.fd(), IORING_REGISTER_PBUF_RING, &reg, 1) != 0) return false;
+        for (unsigned bid = 0; bid < entries; ++bid) put((uint16_t)bid);
+        publish();
+        return true;
+    }
+
+    auto groupId() const -> uint16_t { return group; }
+    auto size() const -> unsigned { return bufSize; }
+    auto buffer(uint16_t bid) -> char* { return data + (size_t)bid * bufSize; }
+
+    // 버퍼 되돌리기 (publish 전까지 커널에 보이지 않음 -> 한 번의 처리에서 모아 되돌림)
+    auto put(uint16_t bid) -> void {
+        // C++ 에서는 __DECLARE_FLEX_ARRAY 의 빈 구조체가 1바이트를 차지해 ring->bufs 가 8바이트 밀림 -> 링 시작을 배열로 직접 봄
+        io_uring_buf& b = ((io_uring_buf*)ring)[tail & mask];
+        b.addr = (uint64_t)(uintptr_t)buffer(bid);
+        b.len = bufSize;
+        b.bid = bid;
+        ++tail;
+    }
+
+    auto publish() -> void { __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE); }
+
+    ~UringBufRing() {
+        if (data != MAP_FAILED) munmap(data, dataSize);
+        if (ring != MAP_FAILED) munmap(ring, ringSize);
+    }
+};
+
+// ===== SQE 준비 =====
+inline void uringPrepPollMulti(io_uring_sqe* s, int fd, uint64_t tag) {
+    s->opcode = IORING_OP_POLL_ADD;
+    s->fd = fd;
+    s->poll32_events = POLLIN;
+    s->len = IORING_POLL_ADD_MULTI;
+    s->user_data = tag;
+}
+
+inline void uringPrepReadMulti(io_uring_sqe* s, int fd, const UringBufRing& bufs, uint64_t tag) {
+    s->opcode = URING_OP_READ_MULTISHOT;
+    s->fd = fd;
+    s->flags = IOSQE_BUFFER_SELECT;
+    s->buf_group = bufs.groupId();
+    s->user_data = tag;
+}
+
+inline void uringPrepRecvMulti(io_uring_sqe* s, int fd, const UringBufRing& bufs, uint64_t tag) {
+    s->opcode = IORING_OP_RECV;
+    s->fd = fd;
+    s->ioprio = IORING_RECV_MULTISHOT;
+    s->flags = IOSQE_BUFFER_SELECT;
+    s->buf_group = bufs.groupId();
+    s->user_data = tag;
+}
+
+inline void uringPrepAcceptMulti(io_uring_sqe* s, int fd, uint64_t tag) {
+    s->opcode = IORING_OP_ACCEPT;
+    s->fd = fd;
+    s->ioprio = IORING_ACCEPT_MULTISHOT;
+    s->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+    s->user_data = tag;
+}
+
+inline void uringPrepSend(io_uring_sqe* s, int fd, const void* buf, unsigned len, uint64_t tag) {
+    s->opcode = IORING_OP_SEND;
+    s->fd = fd;
+    s->addr = (uint64_t)(uintptr_t)buf;
+    s->len = len;
+    s->msg_flags = MSG_NOSIGNAL;
+    s->user_data = tag;
+}
+
+// 실행 중인 커널이 수신 백엔드에 필요한 기능을 모두 지원하는지 (멀티샷 read 가 가장 늦게 들어옴 -> 나머지도 있음)
+inline auto uringSupported() -> bool {
+    UringQueue q;
+    if (!q.open(4, 8)) return false;
+    size_t size = sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op);
+    io_uring_probe* probe = (io_uring_probe*)calloc(1, size);
+    if (probe == nullptr) return false;
+    bool ok = uringRegister(q.fd(), IORING_REGISTER_PROBE, probe, 256) == 0 && probe->ops_len > URING_OP_READ_MULTISHOT
+           && (probe->ops[URING_OP_READ_MULTISHOT].flags & IO_URING_OP_SUPPORTED);
+    free(probe);
+    return ok;
+}
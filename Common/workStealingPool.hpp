@@ -0,0 +1,150 @@
+#pragma once // 인덱스 범위 작업(게임 N판 등)을 코어 수만큼 나눠 실행하는 work-stealing 스레드 풀
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <pthread.h>
+#include <unistd.h>
+
+// [ SRP ] 범위 [0, total) 병렬 실행 전담 (워커 스레드는 풀 수명 동안 유지, run() 마다 재사용)
+// 워커마다 자기 구간(begin | end 를 64비트 하나에 패킹)을 앞에서부터 chunk 단위로 꺼내 쓰고,
+// 자기 구간이 비면 다른 워커 구간의 뒤쪽 절반을 CAS 한 번으로 훔쳐 옴 -> 작업 비용이 고르지 않아도 코어가 놀지 않음
+class WorkStealingPool {
+public:
+    using Body = std::function<void(int worker, uint64_t begin, uint64_t end)>;
+private:
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> span{0}; // begin(32) | end(32) << 32, 소유 워커는 앞에서 / 도둑은 뒤에서 가져감
+        WorkStealingPool* pool = nullptr;
+        int index = 0;
+        pthread_t thread{};
+    };
+
+    int count;
+    Slot* slots;
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t wake = PTHREAD_COND_INITIALIZER;  // 새 작업 / 종료 알림
+    pthread_cond_t done = PTHREAD_COND_INITIALIZER;  // 모든 워커가 현재 작업을 마침
+    uint64_t generation = 0; // run() 호출마다 증가
+    int active = 0;          // 현재 작업을 아직 마치지 않은 워커 수
+    bool stopping = false;
+    const Body* body = nullptr;
+    uint64_t chunk = 1;
+
+    static auto pack(uint64_t begin, uint64_t end) -> uint64_t { return begin | (end << 32); }
+    static auto beginOf(uint64_t span) -> uint64_t { return span & 0xFFFFFFFFULL; }
+    static auto endOf(uint64_t span) -> uint64_t { return span >> 32; }
+
+    // 내 구간 앞쪽에서 최대 chunk 개 확보
+    auto take(Slot& s, uint64_t& begin, uint64_t& end) -> bool {
+        uint64_t cur = s.span.load(std::memory_order_acquire);
+        while (true) {
+            uint64_t b = beginOf(cur), e = endOf(cur);
+            if (b >= e) return false;
+            uint64_t nb = std::min(b + chunk, e);
+            if (s.span.compare_exchange_weak(cur, pack(nb, e), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                begin = b;
+                end = nb;
+                return true;
+            }
+        }
+    }
+
+    // 다른 워커 구간의 뒤쪽 절반을 내 구간으로 옮김 (내 구간이 빈 상태에서만 호출)
+    auto steal(int self) -> bool {
+        for (int k = 1; k < count; ++k) {
+            Slot& victim = slots[(self + k) % count];
+            uint64_t cur = victim.span.load(std::memory_order_acquire);
+            while (true) {
+                uint64_t b = beginOf(cur), e = endOf(cur);
+                if (b >= e) break;
+                uint64_t half = (e - b + 1) / 2;
+                if (victim.span.compare_exchange_weak(cur, pack(b, e - half), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    slots[self].span.store(pack(e - half, e), std::memory_order_release);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    static void* workerThread(void* arg) {
+        Slot* s = reinterpret_cast<Slot*>(arg);
+        s->pool->workerLoop(s->index);
+        return nullptr;
+    }
+
+    auto workerLoop(int self) -> void {
+        uint64_t seen = 0;
+        while (true) {
+            pthread_mutex_lock(&lock);
+            while (!stopping && generation == seen) pthread_cond_wait(&wake, &lock);
+            if (stopping) {
+                pthread_mutex_unlock(&lock);
+                return;
+            }
+            seen = generation;
+            const Body* job = body;
+            pthread_mutex_unlock(&lock);
+
+            uint64_t begin = 0, end = 0;
+            while (true) {
+                if (take(slots[self], begin, end)) {
+                    (*job)(self, begin, end);
+                    continue;
+                }
+                if (!steal(self)) break;
+            }
+
+            pthread_mutex_lock(&lock);
+            if (--active == 0) pthread_cond_signal(&done);
+            pthread_mutex_unlock(&lock);
+        }
+    }
+public:
+    // threads <= 0 -> 온라인 코어 수
+    explicit WorkStealingPool(int threads = 0) {
+        if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        count = std::max(1, threads);
+        slots = new Slot[count];
+        for (int i = 0; i < count; ++i) {
+            slots[i].pool = this;
+            slots[i].index = i;
+            pthread_create(&slots[i].thread, nullptr, workerThread, &slots[i]);
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    auto size() const -> int { return count; }
+
+    // [0, total) 을 워커 수만큼 연속 구간으로 나눠 시작, 모든 인덱스가 처리될 때까지 블록
+    // fn 은 (워커 번호, begin, end) 로 여러 번 호출됨, total 은 32비트 범위 (초과 시 false)
+    auto run(uint64_t total, uint64_t chunkSize, const Body& fn) -> bool {
+        if (total > 0xFFFFFFFFULL) return false;
+        for (int i = 0; i < count; ++i) {
+            slots[i].span.store(pack(total * i / count, total * (i + 1) / count), std::memory_order_relaxed);
+        }
+        pthread_mutex_lock(&lock);
+        body = &fn;
+        chunk = std::max<uint64_t>(1, chunkSize);
+        active = count;
+        ++generation;
+        pthread_cond_broadcast(&wake);
+        while (active > 0) pthread_cond_wait(&done, &lock);
+        body = nullptr;
+        pthread_mutex_unlock(&lock);
+        return true;
+    }
+
+    ~WorkStealingPool() {
+        pthread_mutex_lock(&lock);
+        stopping = true;
+        pthread_cond_broadcast(&wake);
+        pthread_mutex_unlock(&lock);
+        for (int i = 0; i < count; ++i) pthread_join(slots[i].thread, nullptr);
+        delete[] slots;
+    }
+};
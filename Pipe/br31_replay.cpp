@@ -0,0 +1,121 @@
+#include "headerSet.hpp"
+#include "../Common/moveJournal.hpp"
+#include "../Common/benchStats.hpp"
+
+// [ SRP ] 이동 저널 재생 도구
+// pipe_server --journal 이 남긴 세그먼트를 순서대로 mmap 해 게임별 최종 상태(숫자 / 턴 / 패배자)를 다시 만듦
+// 레코드는 16바이트 고정 크기 배열이라 재생은 순차 스캔 한 번 (게임 상태 배열 인덱싱 + 비교 몇 번)
+// 기본으로 각 이동을 규칙과 대조 (턴 주인, 숫자 = 이전 + 개수, 다음 턴), --no-verify 로 생략
+
+struct ReplayGame {
+    uint16_t number = 0;
+    uint8_t players = 0;  // 0 -> JR_START 레코드가 아직 없음
+    uint8_t turn = 0;
+    uint8_t loser = 0;
+    bool over = false;
+    uint32_t moves = 0;
+};
+
+struct ReplayStats {
+    uint64_t records = 0;
+    uint64_t moves = 0;
+    uint64_t errors = 0;
+};
+
+static void printUsage(const char* prog) {
+    cerr << "usage: " << prog << " [-g game] [--no-verify] [journal dir ( 기본 /tmp/br31_journal )]" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+    cout.tie(nullptr);
+
+    const char* dir = "/tmp/br31_journal";
+    long watch = -1; // -g : 이 게임의 이동 기록 출력
+    bool verify = true;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) watch = atol(argv[++i]);
+        else if (strcmp(argv[i], "--no-verify") == 0) verify = false;
+        else if (argv[i][0] == '-') { printUsage(argv[0]); return 1; }
+        else dir = argv[i];
+    }
+
+    vector<ReplayGame> games(MAX_GAMES);
+    ReplayStats st;
+    auto report = [&](const JournalRecord& r, const char* what) {
+        if (st.errors++ < 10) {
+            printf("[ Replay ] #%u G%u P%u : %s\n", r.seq, r.game_id, (unsigned)r.player, what);
+        }
+    };
+
+    JournalReader reader(dir);
+    uint64_t start = benchNowNs();
+    st.records = reader.forEachRun([&](const JournalRecord* recs, uint32_t count) {
+        for (uint32_t i = 0; i < count; ++i) {
+            const JournalRecord& r = recs[i];
+            if (r.game_id >= MAX_GAMES) { report(r, "게임 id 범위 밖"); continue; }
+            ReplayGame& g = games[r.game_id];
+
+            if (r.flags & JR_START) {
+                g = ReplayGame{};
+                g.players = r.cnt;
+                g.turn = r.player;
+                continue;
+            }
+            if (verify) {
+                if (g.players == 0) { report(r, "시작 레코드 없이 이동"); continue; }
+                if (g.over) { report(r, "종료된 게임에 이동"); continue; }
+                if (r.player != g.turn) report(r, "턴 주인이 아닌 플레이어의 이동");
+                if (r.flags & JR_FORFEIT) {
+                    // 턴 기한 초과 기권 : 외친 숫자 없이 종료
+                    if (r.cnt != 0 || r.number != g.number || !(r.flags & JR_FINISHED)) report(r, "기권 레코드 불일치");
+                } else {
+                    if (r.cnt < 1 || r.cnt > MAX_PER_TURN) report(r, "외친 개수 범위 밖");
+                    if (r.number != min(g.number + r.cnt, MAX_NUM)) report(r, "숫자 불일치");
+                }
+                int expectTurn = (r.flags & JR_FINISHED) ? r.player : (r.player % g.players) + 1;
+                if (r.next_turn != expectTurn) report(r, "다음 턴 불일치");
+            }
+            g.number = r.number;
+            g.turn = r.next_turn;
+            g.moves++;
+            st.moves++;
+            if (r.flags & JR_FINISHED) {
+                g.over = true;
+                g.loser = r.player;
+            }
+            if ((long)r.game_id == watch) {
+                printf("        #%-8u P%-2u +%u -> %2u%s\n", r.seq, (unsigned)r.player, (unsigned)r.cnt, (unsigned)r.number,
+                       (r.flags & JR_FORFEIT) ? "  ( GAME OVER : 턴 기한 초과 기권 )" : (r.flags & JR_FINISHED) ? "  ( GAME OVER )" : "");
+            }
+        }
+    });
+    double seconds = (benchNowNs() - start) / 1e9;
+
+    if (st.records == 0) {
+        cerr << "[ Replay ] 저널이 없거나 비어 있음 : " << dir << endl;
+        return 1;
+    }
+
+    uint64_t started = 0, finished = 0;
+    for (const ReplayGame& g : games) {
+        if (g.players == 0) continue;
+        ++started;
+        if (g.over) ++finished;
+    }
+    double bytes = (double)st.records * sizeof(JournalRecord);
+    printf("[ Replay ] %s : segments=%u records=%llu moves=%llu%s\n", dir, reader.segments(), (unsigned long long)st.records,
+           (unsigned long long)st.moves, reader.endedTorn() ? " ( 마지막 레코드 끊김 -> 무시 )" : "");
+    printf("           games=%llu finished=%llu in-progress=%llu errors=%llu\n", (unsigned long long)started,
+           (unsigned long long)finished, (unsigned long long)(started - finished), (unsigned long long)st.errors);
+    printf("           elapsed=%.3fms records/s=%.0f throughput=%.2f GB/s\n", seconds * 1e3,
+           seconds > 0 ? st.records / seconds : 0.0, seconds > 0 ? bytes / seconds / 1e9 : 0.0);
+    if (watch >= 0 && watch < MAX_GAMES && games[watch].players != 0) {
+        const ReplayGame& g = games[watch];
+        printf("           G%ld : number=%u turn=P%u moves=%u %s", watch, (unsigned)g.number, (unsigned)g.turn, g.moves,
+               g.over ? "GAME OVER ( 패배 P" : "진행 중\n");
+        if (g.over) printf("%u )\n", (unsigned)g.loser);
+    }
+    return st.errors == 0 ? 0 : 2;
+}
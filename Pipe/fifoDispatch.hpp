@@ -0,0 +1,346 @@
+#pragma once // FIFO 전송 계층 : 레코드 배치 수신, 세션 / 응답 관리, epoll 대기, 레코드 해석 (pipe_server / br31_server 공통)
+
+#include "headerSet.hpp"
+#include "gameTable.hpp"
+#include <poll.h>
+#include <sys/epoll.h>
+#include <unordered_map>
+
+// 레코드 경계 확인용 : 버전 / 종류가 프로토콜에 있는 값인지
+inline auto moveRecordValid(const MoveRecord& rec) -> bool {
+    return rec.version == MOVE_PROTO_VERSION && rec.type >= REC_CONNECT && rec.type <= REC_DISCONNECT;
+}
+
+// 클라이언트 신호 수신 (pipe_server 는 메인 스레드, br31_server 는 FIFO 수신기 작업에서 처리)
+// 고정 크기 MoveRecord 단위로 FIFO를 읽어 한 번의 read()로 여러 이동을 배치로 꺼냄
+// FIFO 는 누구나 쓸 수 있으므로 (0666) 24바이트 배수가 아닌 write 하나가 이후 레코드 경계를 모두 밀 수 있음
+// -> 해석할 수 없는 레코드를 만나면 그 뒤로 남은 바이트를 버리고 다음 read 부터 경계를 새로 맞춤
+class PipeReceiver {
+    int pipeFd;
+    char buf[MOVE_BATCH * sizeof(MoveRecord)];
+    size_t filled = 0; // 레코드 경계에 걸친 나머지 바이트 (PIPE_BUF 이하 write는 원자적이므로 보통 0)
+public:
+    explicit PipeReceiver(int fd) : pipeFd{fd} {}
+    
+    // FIFO에 쌓인 레코드를 최대 max개 꺼내 도착 순서대로 out에 채움, 0 -> FIFO 비어 있음 (또는 읽은 것을 모두 버림)
+    int readBatch(MoveRecord* out, int max) {
+        size_t want = (size_t)max * sizeof(MoveRecord);
+        if (want > sizeof(buf)) want = sizeof(buf);
+        ssize_t n = read(pipeFd, buf + filled, want - filled);
+        threadMetrics()->add(M_SYSCALLS);
+        if (n <= 0) return 0;
+        filled += n;
+        
+        int total = (int)(filled / sizeof(MoveRecord)), count = 0;
+        for (; count < total; ++count) {
+            memcpy(&out[count], buf + count * sizeof(MoveRecord), sizeof(MoveRecord));
+            if (!moveRecordValid(out[count])) break;
+        }
+        if (count < total) {
+            logPrint(LogLevel::Warn, "[ Pipe ] 해석할 수 없는 레코드 ( v%u type %u ) -> 남은 %zu 바이트 버림", (unsigned)out[count].version,
+                     (unsigned)out[count].type, filled - count * sizeof(MoveRecord));
+            filled = 0;
+            return count;
+        }
+        size_t used = count * sizeof(MoveRecord);
+        memmove(buf, buf + used, filled - used);
+        filled -= used;
+        return count;
+    }
+};
+
+// [ SRP ] 클라이언트 세션 관리 (세션 id -> 게임/플레이어, 응답 FIFO)
+// 세션 id = 인덱스 + 1, 반환된 id는 재사용해 테이블 크기가 동시 접속 수를 넘지 않음
+// 발급한 최대 id 는 공유 메모리(hwm)에 남겨, 웜 재시작 후 기존 클라이언트가 들고 있는 id 를 새 연결에 주지 않음
+// 게임 / 플레이어 자리 하나에 세션 하나 : 자리의 세션이 응답 FIFO 를 읽는 쪽을 잃었으면 (DISCONNECT 없이 죽은 클라이언트) 정리 후 새 연결에 내줌
+class SessionTable {
+    struct Session {
+        int replyFd = -1;
+        int gameId = 0;
+        int playerId = 0;
+        int pid = 0; // CONNECT 의 pid (응답 FIFO 식별자) -> 이후 레코드의 pid 와 대조
+    };
+    vector<Session> sessions;
+    vector<uint32_t> freeIds;
+    unordered_map<uint32_t, uint32_t> owners; // 게임 / 플레이어 자리 -> 세션 id
+    uint32_t* hwm;
+    
+    static auto openReply(int pid) -> int {
+        char path[64];
+        snprintf(path, sizeof(path), REPLY_PATH_FMT, pid);
+        return ::open(path, O_WRONLY | O_NONBLOCK);
+    }
+
+    // 읽는 쪽이 모두 닫힌 FIFO 의 쓰기 fd 는 POLLERR
+    static auto readerGone(int fd) -> bool {
+        pollfd pfd{fd, 0, 0};
+        return poll(&pfd, 1, 0) == 1 && (pfd.revents & POLLERR) != 0;
+    }
+
+    auto bind(uint32_t id, int fd, int pid, int gameId, int playerId) -> void {
+        sessions[id - 1] = Session{fd, gameId, playerId, pid};
+        owners[seatOf(gameId, playerId)] = id;
+    }
+public:
+    // 재시작이면 이전 서버가 발급한 id 구간(1 ~ *hwm)을 복구용으로 비워 둠
+    SessionTable(uint32_t* h, bool reattached) : hwm{h} {
+        if (reattached) sessions.resize(*hwm);
+        else *hwm = 0;
+    }
+    
+    // 응답 FIFO를 열고 세션 id 발급, 실패 시 0
+    auto open(int pid, int gameId, int playerId) -> uint32_t {
+        int fd = openReply(pid);
+        if (fd == -1) { perror("open ( reply fifo )"); return 0; }
+        
+        uint32_t id;
+        if (!freeIds.empty()) {
+            id = freeIds.back();
+            freeIds.pop_back();
+        } else {
+            sessions.emplace_back();
+            id = (uint32_t)sessions.size();
+            __atomic_store_n(hwm, id, __ATOMIC_RELAXED);
+        }
+        bind(id, fd, pid, gameId, playerId);
+        return id;
+    }
+
+    // 자리를 차지한 세션 id (없으면 0), 그 세션의 클라이언트가 사라졌으면 세션을 닫고 0
+    auto occupant(int gameId, int playerId) -> uint32_t {
+        auto it = owners.find(seatOf(gameId, playerId));
+        if (it == owners.end()) return 0;
+        uint32_t id = it->second;
+        if (!readerGone(sessions[id - 1].replyFd)) return id;
+        logPrint(LogLevel::Info, "[  Session  ] 응답 FIFO 를 읽는 쪽 없음 -> S%u 정리", id);
+        close(id);
+        return 0;
+    }
+
+    // 세션을 만들 수 없는 요청에 거절 응답 한 건 (응답 FIFO 를 잠깐 열어 전송, 읽는 쪽이 없으면 버림)
+    static auto reject(int pid, uint32_t seq) -> void {
+        int fd = pid > 0 ? openReply(pid) : -1;
+        if (fd == -1) return;
+        ReplyRecord rec{MOVE_PROTO_VERSION, REPLY_REJECTED, 0, seq, 0, 0};
+        (void)!write(fd, &rec, sizeof(rec));
+        ::close(fd);
+        threadMetrics()->add(M_SYSCALLS, 3);
+    }
+    
+    // 웜 재시작 전에 발급된 세션 복구 (레코드에 실린 pid / 게임 / 플레이어로 응답 FIFO 다시 열기)
+    auto restore(uint32_t id, int pid, int gameId, int playerId) -> bool {
+        if (id == 0 || id > sessions.size() || sessions[id - 1].replyFd != -1 || pid <= 0) return false;
+        if (occupant(gameId, playerId) != 0) return false;
+        int fd = openReply(pid);
+        if (fd == -1) return false;
+        bind(id, fd, pid, gameId, playerId);
+        return true;
+    }
+    
+    auto gameOf(uint32_t id) -> int { return valid(id) ? sessions[id - 1].gameId : -1; }
+    auto pidOf(uint32_t id) -> int { return valid(id) ? sessions[id - 1].pid : 0; }
+    auto playerOf(uint32_t id) -> int { return valid(id) ? sessions[id - 1].playerId : 0; }
+    auto valid(uint32_t id) -> bool { return id >= 1 && id <= sessions.size() && sessions[id - 1].replyFd != -1; }
+    
+    // 응답 FIFO에 결과 한 건 전송 (클라이언트가 읽지 않아 가득 찬 경우 버림)
+    auto reply(uint32_t id, int16_t status, uint32_t seq, int number, int turn) -> void {
+        if (!valid(id)) return;
+        ReplyRecord rec{MOVE_PROTO_VERSION, status, id, seq, number, turn};
+        (void)!write(sessions[id - 1].replyFd, &rec, sizeof(rec));
+        threadMetrics()->add(M_SYSCALLS);
+    }
+    
+    auto close(uint32_t id) -> void {
+        if (!valid(id)) return;
+        Session& s = sessions[id - 1];
+        ::close(s.replyFd);
+        auto it = owners.find(seatOf(s.gameId, s.playerId));
+        if (it != owners.end() && it->second == id) owners.erase(it);
+        s = Session{};
+        freeIds.push_back(id);
+    }
+    
+    ~SessionTable() {
+        for (auto& s : sessions) if (s.replyFd != -1) ::close(s.replyFd);
+    }
+};
+
+// [ SRP ] 응답 전송 시점 관리
+// durable 저널이면 배치의 응답을 모아 두었다가 저널 그룹 커밋(msync) 뒤에 한꺼번에 전송
+// -> 클라이언트가 응답을 받은 이동은 디스크에 남아 있음, 아니면 바로 전송
+class ReplyQueue {
+    struct Pending {
+        uint32_t id;
+        int16_t status;
+        uint32_t seq;
+        int number;
+        int turn;
+    };
+    SessionTable& sessions;
+    bool deferred;
+    Pending pending[MOVE_BATCH];
+    int count = 0;
+public:
+    ReplyQueue(SessionTable& s, bool defer) : sessions{s}, deferred{defer} {}
+    
+    auto send(uint32_t id, int16_t status, uint32_t seq, int number, int turn) -> void {
+        if (!deferred || count == MOVE_BATCH) {
+            sessions.reply(id, status, seq, number, turn);
+            return;
+        }
+        pending[count++] = Pending{id, status, seq, number, turn};
+    }
+    
+    auto flush() -> void {
+        for (int i = 0; i < count; ++i) sessions.reply(pending[i].id, pending[i].status, pending[i].seq, pending[i].number, pending[i].turn);
+        count = 0;
+    }
+};
+
+// [ SRP ] FIFO / 종료 신호 / 턴 기한 타이머 이벤트 대기 (epoll)
+// 빈 read 후 usleep 폴링 대신 FIFO에 데이터가 도착하거나 시그널 / 기한이 올 때까지 블록
+class EventWaiter {
+    int epFd = -1;
+    int fifoFd;
+    int signalFd;
+    int timerFd;
+    bool timerReady = false;
+public:
+    // timer : 턴 기한 timerfd (-1 -> 등록하지 않음)
+    EventWaiter(int fifo, int sig, int timer = -1) : fifoFd{fifo}, signalFd{sig}, timerFd{timer} {
+        epFd = epoll_create1(EPOLL_CLOEXEC);
+        if (epFd == -1) { perror("epoll_create1"); return; }
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.fd = fifoFd;
+        epoll_ctl(epFd, EPOLL_CTL_ADD, fifoFd, &ev);
+        ev.data.fd = signalFd;
+        epoll_ctl(epFd, EPOLL_CTL_ADD, signalFd, &ev);
+        if (timerFd != -1) {
+            ev.data.fd = timerFd;
+            epoll_ctl(epFd, EPOLL_CTL_ADD, timerFd, &ev);
+        }
+    }
+    
+    auto valid() -> bool { return epFd != -1; }
+    
+    // true -> FIFO 읽기 가능 또는 기한 타이머 만료 (timerExpired 로 확인), false -> 종료 신호 수신 / timeoutMs 경과 (-1 -> 무기한)
+    auto wait(int timeoutMs = -1) -> bool {
+        epoll_event events[3];
+        while (true) {
+            int n = epoll_wait(epFd, events, 3, timeoutMs);
+            threadMetrics()->add(M_SYSCALLS);
+            if (n == 0) return false;
+            if (n == -1) {
+                if (errno == EINTR) continue;
+                perror("epoll_wait");
+                return false;
+            }
+            bool readable = false;
+            for (int i = 0; i < n; ++i) {
+                if (events[i].data.fd == signalFd) return false;
+                if (events[i].data.fd == timerFd) timerReady = true;
+                readable = true;
+            }
+            if (readable) return true;
+        }
+    }
+    
+    // 마지막 wait 이후 기한 타이머가 울렸는지 (확인하면 내려감)
+    auto timerExpired() -> bool {
+        bool r = timerReady;
+        timerReady = false;
+        return r;
+    }
+    
+    ~EventWaiter() {
+        if (epFd != -1) close(epFd);
+    }
+};
+
+// [ SRP ] FIFO 레코드 해석 (연결 / 종료 / 이동 -> 세션 확인 후 GameTable::apply)
+// 배치 하나를 처리한 뒤 저널 그룹 커밋, 응답 전송
+class FifoDispatcher {
+    GameTable& games;
+    SessionTable sessions;
+    ReplyQueue replies;
+    bool reattached;
+public:
+    // 재시작이면 이전 서버가 발급한 세션 id 를 레코드에 실린 값으로 복구, deferReplies -> durable 저널 커밋 뒤 응답
+    FifoDispatcher(GameTable& g, uint32_t* sessionHwm, bool restarted, bool deferReplies)
+        : games{g}, sessions{sessionHwm, restarted}, replies{sessions, deferReplies}, reattached{restarted} {}
+
+    auto dispatch(const MoveRecord* batch, int n) -> void {
+        for (int i = 0; i < n && games.unfinished() > 0; ++i) {
+            const MoveRecord& rec = batch[i];
+            if (!moveRecordValid(rec)) continue; // 수신 쪽에서 이미 걸러 냄 (레코드를 직접 넘기는 호출자 대비)
+
+            if (rec.type == REC_CONNECT) {
+                // 범위 밖 게임 / 플레이어, 이미 연결된 자리는 레코드의 pid 로 거절 응답 (클라이언트가 응답을 기다리며 멈추지 않게)
+                uint32_t id = 0;
+                GameLogic* target = games.logic((int)rec.game_id);
+                bool seat = target != nullptr && rec.player_id >= 1 && rec.player_id <= target->getState().getPlayers();
+                if (seat && sessions.occupant((int)rec.game_id, rec.player_id) == 0) {
+                    id = sessions.open(rec.pid, (int)rec.game_id, rec.player_id);
+                }
+                if (id == 0) {
+                    logPrint(LogLevel::Warn, "[  Session  ] 연결 거절 ( G%u P%u pid %d%s )", rec.game_id, (unsigned)rec.player_id, rec.pid,
+                             seat ? " : 이미 연결된 자리" : "");
+                    SessionTable::reject(rec.pid, rec.seq);
+                    continue;
+                }
+                games.joined((int)rec.game_id);
+                replies.send(id, REPLY_OK, rec.seq, 0, 0);
+                logPrint(LogLevel::Info, "[  Session  ] 연결 S%u ( G%u P%u )", id, rec.game_id, (unsigned)rec.player_id);
+                continue;
+            }
+            if (rec.type == REC_DISCONNECT) {
+                if (!sessions.valid(rec.session_id) || sessions.pidOf(rec.session_id) != rec.pid) continue;
+                logPrint(LogLevel::Info, "[  Session  ] 종료 S%u", rec.session_id);
+                sessions.close(rec.session_id);
+                continue;
+            }
+            if (rec.type != REC_MOVE) continue;
+            if (!sessions.valid(rec.session_id)) {
+                // 재시작 전 세션 : 레코드에 실린 게임 / 플레이어가 유효하면 같은 id 로 복구
+                GameLogic* target = games.logic((int)rec.game_id);
+                if (!reattached || target == nullptr || rec.player_id < 1 || rec.player_id > target->getState().getPlayers()
+                    || !sessions.restore(rec.session_id, rec.pid, (int)rec.game_id, rec.player_id)) {
+                    continue;
+                }
+                logPrint(LogLevel::Info, "[  Session  ] 복구 S%u ( G%u P%u )", rec.session_id, rec.game_id, (unsigned)rec.player_id);
+                games.joined((int)rec.game_id);
+            } else if (sessions.pidOf(rec.session_id) != rec.pid) {
+                // 다른 클라이언트의 세션 id 로 보낸 이동 : 세션 주인이 아니라 보낸 쪽에 거절
+                logPrint(LogLevel::Warn, "[  Session  ] S%u 의 pid 불일치 ( %d != %d ) -> 거절", rec.session_id, rec.pid,
+                         sessions.pidOf(rec.session_id));
+                SessionTable::reject(rec.pid, rec.seq);
+                continue;
+            }
+
+            // 게임/플레이어는 레코드가 아니라 세션에 기록된 값을 사용
+            int gameId = sessions.gameOf(rec.session_id), playerId = sessions.playerOf(rec.session_id), cnt = rec.cnt;
+            GameLogic* logic = games.logic(gameId);
+            if (logic == nullptr) {
+                replies.send(rec.session_id, REPLY_REJECTED, rec.seq, 0, 0);
+                continue;
+            }
+            GameState& state = logic->getState();
+            if (state.isGameOver()) {
+                replies.send(rec.session_id, REPLY_GAME_OVER, rec.seq, state.getNumber(), state.getTurn());
+                continue;
+            }
+
+            char tag[32] = "";
+            if (games.size() > 1) snprintf(tag, sizeof(tag), "[ Game %d ] ", gameId);
+            logPrint(LogLevel::Info, "%s[    Pipe   ] ( 신호 감지 -> 턴 진행 P%d #%u )", tag, playerId, rec.seq);
+            MoveResult r = games.apply(gameId, playerId, cnt);
+            int16_t status = replyStatusOf(r);
+            replies.send(rec.session_id, status, rec.seq, state.getNumber(), state.getTurn());
+        }
+
+        // 그룹 커밋 : 배치 하나의 이동을 한 번에 msync 한 뒤 응답 전송
+        games.commitJournal();
+        replies.flush();
+    }
+};
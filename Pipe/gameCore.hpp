@@ -0,0 +1,320 @@
+#pragma once // 게임 규칙 코어 : 서버(pipe_server)와 인프로세스 시뮬레이터(br31_sim)가 함께 사용
+
+#include "headerSet.hpp"
+#include "../Common/asyncLogger.hpp"
+#include "../Common/pacing.hpp"
+#include "../Common/moveJournal.hpp"
+#include "../Common/serverMetrics.hpp"
+#include "../Common/shmMutex.hpp"
+
+// GameState 는 SharedData 하나만 가리키므로 공유 메모리 슬롯이든 일반 메모리든 그대로 동작
+// 클라이언트가 잠금 없이 읽는 필드(숫자 / 턴 / 개수 / 종료)는 shmStore 로 쓰고, gameover 는 마지막에 (종료를 보면 마지막 숫자도 보임)
+
+// GameState::commitMove / GameTable::apply 결과
+enum class MoveResult {
+    Applied,   // 숫자 반영 + 턴 교대 완료
+    Finished,  // 이번 이동으로 MAX_NUM 도달 (호출한 플레이어 패배)
+    WrongTurn, // 현재 턴이 아닌 플레이어
+    Ignored,   // 이미 종료된 게임
+    BadCount   // 외친 개수가 1 ~ MAX_PER_TURN 밖 (GameTable::apply 에서 거절, 상태 변화 없음)
+};
+
+#ifdef BR31_LOCKFREE_STATE
+// [ SRP ] 게임 상태 관리 ( lock-free : 상태 전체를 64비트 원자 변수 하나에 패킹 )
+// state_word = number(16) | turn(16) | cnt(16) | gameover(1) -> 이동 하나가 CAS 한 번
+// 평문 필드(current_num, current_turn ...)는 클라이언트가 읽는 미러로만 갱신
+class GameState {
+    SharedData* data;
+    
+    static constexpr uint64_t FIELD_MASK = 0xFFFF;
+    static constexpr uint64_t OVER_BIT = 1ULL << 48;
+    
+    static auto pack(int num, int turn, int cnt, bool over) -> uint64_t {
+        return (uint64_t)(num & FIELD_MASK) | ((uint64_t)(turn & FIELD_MASK) << 16)
+             | ((uint64_t)(cnt & FIELD_MASK) << 32) | (over ? OVER_BIT : 0);
+    }
+    static auto numOf(uint64_t w) -> int { return (int)(w & FIELD_MASK); }
+    static auto turnOf(uint64_t w) -> int { return (int)((w >> 16) & FIELD_MASK); }
+    static auto cntOf(uint64_t w) -> int { return (int)((w >> 32) & FIELD_MASK); }
+    static auto overOf(uint64_t w) -> bool { return (w & OVER_BIT) != 0; }
+    
+    auto load() -> uint64_t { return data->state_word.load(memory_order_acquire); }
+    
+    auto mirror(uint64_t w) -> void {
+        shmStore(data->current_num, numOf(w));
+        shmStore(data->current_turn, turnOf(w));
+        shmStore(data->current_cnt, cntOf(w));
+        shmStore(data->gameover, overOf(w));
+    }
+    
+    // 현재 상태에 f를 적용한 새 상태로 CAS (경합 시 재시도)
+    template <typename F>
+    auto update(F f) -> uint64_t {
+        uint64_t cur = load();
+        uint64_t next;
+        do {
+            next = f(cur);
+        } while (next != cur && !data->state_word.compare_exchange_weak(cur, next, memory_order_acq_rel, memory_order_acquire));
+        return next;
+    }
+public:
+    explicit GameState(SharedData* ptr) : data{ptr} {}
+    
+    auto getCnt() -> int { return cntOf(load()); }
+    auto isGameOver() -> bool { return overOf(load()); }
+    auto getNumber() -> int { return numOf(load()); }
+    auto getTurn() -> int { return turnOf(load()); }
+    auto getCaller() -> string { return data->last_caller; }
+    
+    auto updateNumber(int cnt, int callerId) -> void {
+        for (int i = 0; i < cnt; ++i) {
+            uint64_t w = update([](uint64_t c) { return pack(numOf(c) + 1, turnOf(c), cntOf(c), overOf(c)); });
+            mirror(w);
+            logPrint(LogLevel::Info, "[ Client P%d ] 외친 숫자 = %d", callerId, numOf(w));
+            paceSleep(Pacing::get().numberUs);
+        }
+    }
+    
+    auto switchTurn() -> void {
+        const TurnRing& ring = data->turn_ring;
+        mirror(update([&ring](uint64_t c) { return pack(numOf(c), turnRingNext(ring, turnOf(c)), cntOf(c), overOf(c)); }));
+    }
+    
+    auto getPlayers() -> int { return data->turn_ring.players; }
+    
+    // 턴 순서 링 초기화 후 게임 시작 상태로 (링은 이후 읽기 전용이라 state_word 에 넣지 않음)
+    auto start(int players, int firstTurn) -> void {
+        turnRingInit(data->turn_ring, players);
+        uint64_t w = pack(0, firstTurn, 0, false);
+        data->state_word.store(w, memory_order_release);
+        mirror(w);
+    }
+    
+    // 웜 재시작 : state_word 가 원본이므로 평문 미러와 패배자 기록만 다시 맞춤 (CAS 한 번이라 반쯤 반영된 이동이 없음)
+    auto repair() -> bool {
+        uint64_t w = load();
+        bool fixed = numOf(w) != data->current_num || turnOf(w) != data->current_turn || overOf(w) != data->gameover;
+        if (overOf(w) && data->last_caller[0] == '\0') {
+            snprintf(data->last_caller, sizeof(data->last_caller), "P%d", turnOf(w));
+            fixed = true;
+        }
+        mirror(w);
+        return fixed;
+    }
+    
+    // 턴 검증과 적용을 CAS 한 번으로 처리 (검증한 상태 그대로 갱신되었음이 보장됨)
+    auto commitMove(int playerId, int cnt, int& from) -> MoveResult {
+        uint64_t cur = load();
+        while (true) {
+            from = numOf(cur);
+            if (overOf(cur)) return MoveResult::Ignored;
+            if (playerId != turnOf(cur)) return MoveResult::WrongTurn;
+            
+            int num = min(from + cnt, MAX_NUM);
+            bool over = num >= MAX_NUM;
+            int turn = over ? turnOf(cur) : turnRingNext(data->turn_ring, turnOf(cur));
+            uint64_t next = pack(num, turn, cnt, over);
+            if (data->state_word.compare_exchange_weak(cur, next, memory_order_acq_rel, memory_order_acquire)) {
+                if (over) snprintf(data->last_caller, sizeof(data->last_caller), "P%d", playerId);
+                mirror(next);
+                return over ? MoveResult::Finished : MoveResult::Applied;
+            }
+        }
+    }
+    
+    auto setGameOver(const string& caller) -> void {
+        strncpy(data->last_caller, caller.c_str(), sizeof(data->last_caller));
+        mirror(update([](uint64_t c) { return pack(numOf(c), turnOf(c), cntOf(c), true); }));
+    }
+};
+#else
+// [ SRP ] 게임 상태 관리 ( pthread_mutex )
+class GameState {
+    SharedData* data;
+    pthread_mutex_t lock;
+public:
+    explicit GameState(SharedData* ptr) : data{ptr} {
+        pthread_mutex_init(&lock, nullptr);
+    }
+    
+    auto getCnt() -> int {
+        pthread_mutex_lock(&lock);
+        int c = data->current_cnt;
+        pthread_mutex_unlock(&lock);
+        return c;
+    }
+    
+    auto isGameOver() -> bool {
+        pthread_mutex_lock(&lock);
+        bool over = data->gameover;
+        pthread_mutex_unlock(&lock);
+        return over;
+    }
+    
+    auto getNumber() -> int {
+        pthread_mutex_lock(&lock);
+        int n = data->current_num;
+        pthread_mutex_unlock(&lock);
+        return n;
+    }
+    
+    auto getTurn() -> int {
+        pthread_mutex_lock(&lock);
+        int t = data->current_turn;
+        pthread_mutex_unlock(&lock);
+        return t;
+    }
+    
+    auto getCaller() -> string {
+        pthread_mutex_lock(&lock);
+        string s = data->last_caller;
+        pthread_mutex_unlock(&lock);
+        return s;
+    }
+    
+    auto updateNumber(int cnt, int callerId) -> void {
+        pthread_mutex_lock(&lock);
+        for (int i = 0; i < cnt; ++i) {
+            shmStore(data->current_num, data->current_num + 1);
+            logPrint(LogLevel::Info, "[ Client P%d ] 외친 숫자 = %d", callerId, data->current_num);
+            paceSleep(Pacing::get().numberUs);
+        }
+        pthread_mutex_unlock(&lock);
+    }
+    
+    auto switchTurn() -> void {
+        pthread_mutex_lock(&lock);
+        shmStore(data->current_turn, turnRingNext(data->turn_ring, data->current_turn));
+        pthread_mutex_unlock(&lock);
+    }
+    
+    auto getPlayers() -> int { return data->turn_ring.players; }
+    
+    // 턴 순서 링 + 게임 시작 상태로 초기화 (첫 턴 지정)
+    auto start(int players, int firstTurn) -> void {
+        pthread_mutex_lock(&lock);
+        turnRingInit(data->turn_ring, players);
+        shmStore(data->current_num, 0);
+        shmStore(data->current_turn, firstTurn);
+        shmStore(data->current_cnt, 0);
+        shmStore(data->gameover, false);
+        pthread_mutex_unlock(&lock);
+    }
+    
+    // 턴 검증 + 숫자 갱신 + 종료 판단 + 턴 교대를 한 번의 임계 구역에서 처리
+    // from : 이번 이동 전의 숫자 (호출자가 외친 숫자 출력에 사용)
+    auto commitMove(int playerId, int cnt, int& from) -> MoveResult {
+        pthread_mutex_lock(&lock);
+        MoveResult r;
+        from = data->current_num;
+        if (data->gameover) {
+            r = MoveResult::Ignored;
+        } else if (playerId != data->current_turn) {
+            r = MoveResult::WrongTurn;
+        } else {
+            moveIntentBegin(data->intent, playerId, from, cnt); // 여기서 죽으면 재시작 시 repair() 가 마저 적용
+            int num = min(from + cnt, MAX_NUM);
+            shmStore(data->current_num, num);
+            shmStore(data->current_cnt, cnt);
+            if (num >= MAX_NUM) {
+                snprintf(data->last_caller, sizeof(data->last_caller), "P%d", playerId);
+                shmStore(data->gameover, true);
+                r = MoveResult::Finished;
+            } else {
+                shmStore(data->current_turn, turnRingNext(data->turn_ring, data->current_turn));
+                r = MoveResult::Applied;
+            }
+            moveIntentEnd(data->intent);
+        }
+        pthread_mutex_unlock(&lock);
+        return r;
+    }
+    
+    // 웜 재시작 : 반영 도중 멈춘 이동(MoveIntent)을 끝까지 적용
+    auto repair() -> bool {
+        pthread_mutex_lock(&lock);
+        bool fixed = moveIntentRepair(*data, MAX_NUM);
+        pthread_mutex_unlock(&lock);
+        return fixed;
+    }
+    
+    auto setGameOver(const string& caller) -> void {
+        pthread_mutex_lock(&lock);
+        strncpy(data->last_caller, caller.c_str(), sizeof(data->last_caller));
+        shmStore(data->gameover, true);
+        pthread_mutex_unlock(&lock);
+    }
+    
+    ~GameState() {
+        pthread_mutex_destroy(&lock);
+    }
+};
+
+#endif
+
+// [ SRP ] 게임 규칙 적용
+class GameLogic {
+    GameState& state;
+    string tag; // 멀티 게임 모드에서 로그 앞에 붙는 게임 식별자
+    MoveJournal* journal = nullptr; // 반영된 이동 기록 (없으면 기록 안 함)
+    pthread_mutex_t* journalLock = nullptr; // 여러 수신 스레드가 같은 저널에 기록하면 지정 (br31_server)
+    uint32_t gameId = 0;
+public:
+    explicit GameLogic(GameState& s, const string& t = "") : state{s}, tag{t} {}
+    
+    GameState& getState() { return state; }
+    
+    auto attachJournal(MoveJournal* j, uint32_t id, pthread_mutex_t* lock = nullptr) -> void {
+        journal = j;
+        gameId = id;
+        journalLock = lock;
+    }
+    
+    MoveResult applyMove(int playerId, int cnt) {
+        MetricsSlot& metrics = *threadMetrics();
+        uint64_t started = metricsNowNs();
+        int from = 0;
+        MoveResult r = state.commitMove(playerId, cnt, from);
+        if (r == MoveResult::Ignored) return r;
+        if (r == MoveResult::WrongTurn) {
+            metrics.add(M_WRONG_TURN);
+            logPrint(LogLevel::Warn, "%s[ logic ] 잘못된 턴 접근 P%d", tag.c_str(), playerId);
+            return r;
+        }
+        
+        // 반영 직후 (연출 지연 전에) 저널 기록 -> 반영됐지만 기록되지 않은 채 죽는 구간을 최소화
+        if (journal != nullptr) {
+            bool over = r == MoveResult::Finished;
+            if (journalLock != nullptr) pthread_mutex_lock(journalLock);
+            journal->append(gameId, over ? JR_MOVE | JR_FINISHED : JR_MOVE, playerId, cnt, min(from + cnt, MAX_NUM),
+                            over ? playerId : state.getTurn());
+            if (journalLock != nullptr) pthread_mutex_unlock(journalLock);
+        }
+        
+        int to = min(from + cnt, MAX_NUM);
+        for (int n = from + 1; n <= to; ++n) {
+            logPrint(LogLevel::Info, "%s[ Client P%d ] 외친 숫자 = %d", tag.c_str(), playerId, n);
+            paceSleep(Pacing::get().numberUs);
+        }
+        
+        if (r == MoveResult::Finished) {
+            metrics.add(M_GAMES_FINISHED);
+            logPrint(LogLevel::Info, "%s[ Result ] GAME OVER ( 패배한 클라이언트 -> P%d!! )", tag.c_str(), playerId);
+        }
+        metrics.add(M_MOVES_APPLIED);
+        metrics.record(H_APPLY_NS, metricsNowNs() - started);
+        return r;
+    }
+    
+    // 턴 기한 초과 : 턴 주인의 기권 패로 종료 (숫자는 그대로, 저널에는 cnt 0 + JR_FORFEIT)
+    auto forfeit(int playerId) -> void {
+        state.setGameOver("P" + to_string(playerId));
+        if (journal != nullptr) {
+            if (journalLock != nullptr) pthread_mutex_lock(journalLock);
+            journal->append(gameId, JR_MOVE | JR_FINISHED | JR_FORFEIT, playerId, 0, state.getNumber(), playerId);
+            if (journalLock != nullptr) pthread_mutex_unlock(journalLock);
+        }
+        threadMetrics()->add(M_GAMES_FINISHED);
+        logPrint(LogLevel::Info, "%s[ Result ] GAME OVER ( 턴 기한 초과 -> P%d 기권 패 )", tag.c_str(), playerId);
+    }
+};
@@ -0,0 +1,241 @@
+#pragma once // 게임 슬롯 테이블 : 전송 방식과 무관한 이동 반영 창구 (pipe_server / br31_server 공통)
+
+#include "gameCore.hpp"
+#include "../Common/futex.hpp"
+#include "../Common/spectatorChannel.hpp"
+#include "../Common/strategyTable.hpp"
+#include "../Common/turnDeadline.hpp"
+#include <deque>
+#include <functional>
+#include <memory>
+
+// 이동 결과 -> 응답 상태 (FIFO / 소켓 / 메시지 큐 디스패처 공통)
+inline auto replyStatusOf(MoveResult r) -> int16_t {
+    switch (r) {
+    case MoveResult::Applied: return REPLY_OK;
+    case MoveResult::WrongTurn: return REPLY_WRONG_TURN;
+    case MoveResult::BadCount: return REPLY_REJECTED;
+    default: return REPLY_GAME_OVER;
+    }
+}
+
+// 게임 / 플레이어 자리 키 (자리 하나에 연결 하나 : FIFO 세션 / 소켓 연결 테이블 공통)
+inline auto seatOf(int gameId, int playerId) -> uint32_t { return (uint32_t)gameId * MAX_PLAYERS + (uint32_t)(playerId - 1); }
+
+// [ SRP ] 게임 슬롯 테이블 (게임 id -> 슬롯 하나의 GameState/GameLogic)
+// 슬롯 수는 시작 시 고정되므로 메모리 사용량과 이동당 비용(인덱싱 O(1))이 게임 수와 무관
+// fresh 가 아니면 (웜 재시작) 슬롯을 초기화하지 않고 반쯤 반영된 이동만 복구
+// concurrent : 여러 수신 스레드가 apply 를 호출 (br31_server) -> 게임별 락으로 반영 + 저널 기록 + 관찰자 통지 순서를 맞춤
+// 턴 기한 (attachDeadlines) : 첫 연결 / 이동부터 턴마다 기한을 걸고, 지나면 서버가 기권 처리 또는 대신 이동
+class GameTable {
+public:
+    // 이동이 반영되거나 게임이 끝날 때마다 호출 (게임 락 안, 반영 순서대로)
+    // playerId / cnt : 반영된 이동 (외부 종료로 끝나면 0, 턴 기한 초과 기권이면 cnt 만 0)
+    using Observer = function<void(int gameId, GameState& state, int playerId, int cnt)>;
+    using Bot = StrategyTable<MAX_NUM, MAX_PER_TURN>; // 기한 초과 시 대신 둘 수
+private:
+    SharedTable* table;
+    deque<GameState> states;
+    deque<GameLogic> logics;
+    int repaired = 0;
+    atomic<uint32_t> remaining{0}; // 끝나지 않은 게임 수 (futex 워드 : waitFinished 가 0 이 될 때까지 대기)
+    MoveJournal& journal;
+    bool concurrent;
+    pthread_mutex_t journalLock = PTHREAD_MUTEX_INITIALIZER;
+    unique_ptr<pthread_mutex_t[]> gameLocks;
+    vector<Observer> observers;
+    TurnDeadlines* deadlines = nullptr;
+    TurnTimeout onTimeout = TurnTimeout::Forfeit;
+
+    // 관찰자 통지 후 턴 알림 (그 게임에서 차례를 기다리는 클라이언트를 깨움)
+    auto notify(int gameId, GameState& state, int playerId, int cnt) -> void {
+        for (auto& o : observers) o(gameId, state, playerId, cnt);
+        turnSignalRaise(table->games[gameId].turn_signal);
+    }
+
+    auto lockGame(int gameId) -> void {
+        if (concurrent) pthread_mutex_lock(&gameLocks[gameId]);
+    }
+    auto unlockGame(int gameId) -> void {
+        if (concurrent) pthread_mutex_unlock(&gameLocks[gameId]);
+    }
+
+    // 게임 락 안에서 이동 반영 + 기한 갱신 + 통지
+    auto applyLocked(int gameId, int playerId, int cnt) -> MoveResult {
+        GameLogic& l = logics[gameId];
+        MoveResult r = l.applyMove(playerId, cnt);
+        GameState& state = l.getState();
+        char tag[32];
+        if (r == MoveResult::Finished) {
+            logPrint(LogLevel::Info, "%s[ Broadcast ] 패배한 클라이언트 프로세스 : %s", tagOf(gameId, tag, sizeof(tag)), state.getCaller().c_str());
+            finished(gameId);
+        } else if (r != MoveResult::Ignored) {
+            // 브로드캐스트 (턴 교체는 applyMove 내부에서 완료)
+            logPrint(LogLevel::Info, "%s[ Broadcast ] ( 턴 교체 -> 다음 턴 P%d )", tagOf(gameId, tag, sizeof(tag)), state.getTurn());
+        }
+        if (r == MoveResult::Applied && deadlines != nullptr) deadlines->arm(gameId);
+        if (r == MoveResult::Applied || r == MoveResult::Finished) notify(gameId, state, playerId, cnt);
+        return r;
+    }
+
+    auto finished(int gameId) -> void {
+        if (deadlines != nullptr) deadlines->cancel(gameId);
+        remaining.fetch_sub(1, memory_order_acq_rel);
+        futexWake(&remaining);
+    }
+
+    auto tagOf(int gameId, char* buf, size_t len) -> const char* {
+        buf[0] = '\0';
+        if (size() > 1) snprintf(buf, len, "[ Game %d ] ", gameId);
+        return buf;
+    }
+public:
+    GameTable(SharedTable* t, int count, int players, MoveJournal& j, bool fresh, bool shared = false)
+        : table{t}, journal{j}, concurrent{shared} {
+        for (int i = 0; i < count; ++i) {
+            SharedData& slot = table->games[i];
+            states.emplace_back(&slot);
+            if (fresh) {
+                states.back().start(players, 1);
+                journal.append((uint32_t)i, JR_START, 1, players, 0, 1);
+            } else {
+                MoveIntent pending = slot.intent;
+                if (states.back().repair()) {
+                    ++repaired;
+                    // 의도가 남아 있었다면 저널 기록 전에 멈춘 이동 -> 복구 결과를 기록
+                    if (pending.pending != 0) {
+                        bool over = states.back().isGameOver();
+                        journal.append((uint32_t)i, over ? JR_MOVE | JR_FINISHED : JR_MOVE, pending.player, pending.cnt,
+                                       states.back().getNumber(), states.back().getTurn());
+                    }
+                }
+            }
+            logics.emplace_back(states.back(), count > 1 ? "[ Game " + to_string(i) + " ] " : "");
+            logics.back().attachJournal(journal.isOpen() ? &journal : nullptr, (uint32_t)i, concurrent ? &journalLock : nullptr);
+            if (!states.back().isGameOver()) ++remaining;
+        }
+        if (concurrent) {
+            gameLocks.reset(new pthread_mutex_t[count]);
+            for (int i = 0; i < count; ++i) pthread_mutex_init(&gameLocks[i], nullptr);
+        }
+    }
+
+    GameTable(const GameTable&) = delete;
+    GameTable& operator=(const GameTable&) = delete;
+
+    ~GameTable() {
+        if (gameLocks) for (int i = 0; i < size(); ++i) pthread_mutex_destroy(&gameLocks[i]);
+        pthread_mutex_destroy(&journalLock);
+    }
+
+    auto repairedCount() -> int { return repaired; }
+    auto unfinished() -> int { return (int)remaining.load(memory_order_acquire); }
+    auto size() -> int { return (int)logics.size(); }
+
+    // 수신기 시작 전에만 등록 (이후 읽기 전용)
+    auto addObserver(Observer o) -> void { observers.push_back(std::move(o)); }
+
+    // 관전 채널 연결 : 게임마다 현재 상태를 SPEC_START 로 한 번 발행한 뒤 이동 / 종료마다 발행 (수신기 시작 전에)
+    auto attachSpectators(SpectatorChannel& channel) -> void {
+        if (!channel.isOpen()) return;
+        for (int i = 0; i < size(); ++i) {
+            GameState& s = states[i];
+            channel.publish(SPEC_START, i, s.getPlayers(), 0, s.getNumber(), s.getTurn());
+            if (s.isGameOver()) channel.publish(SPEC_OVER, i, s.getTurn(), 0, s.getNumber(), s.getTurn());
+        }
+        addObserver([&channel](int id, GameState& s, int playerId, int cnt) {
+            if (playerId != 0 && cnt != 0) channel.publish(SPEC_MOVE, id, playerId, cnt, s.getNumber(), s.getTurn());
+            if (s.isGameOver()) channel.publish(SPEC_OVER, id, playerId, cnt, s.getNumber(), s.getTurn());
+        });
+    }
+
+    // 턴 기한 연결 (수신기 시작 전에) : 기한은 그 게임의 첫 연결(joined) 또는 첫 이동부터
+    // startNow : 웜 재시작 -> 진행 중인 게임은 클라이언트가 이미 붙어 있으므로 바로 시작
+    auto attachDeadlines(TurnDeadlines& d, TurnTimeout policy, bool startNow) -> void {
+        if (!d.enabled()) return;
+        deadlines = &d;
+        onTimeout = policy;
+        if (!startNow) return;
+        for (int i = 0; i < size(); ++i) {
+            if (!states[i].isGameOver()) d.start(i);
+        }
+    }
+
+    // 플레이어 연결 / 세션 복구 : 그 게임의 기한이 아직 없으면 시작
+    auto joined(int gameId) -> void {
+        if (deadlines == nullptr || logic(gameId) == nullptr || states[gameId].isGameOver()) return;
+        deadlines->start(gameId);
+    }
+
+    // 턴 기한 만료 (TurnDeadlines::expire 의 콜백) : 턴 주인의 기권 패 또는 전략 표의 수로 대신 이동
+    // 꺼낸 뒤 게임 락을 잡기 전에 이동이 반영됐으면 기한이 다시 걸려 있음 -> 무시
+    auto expireTurn(int gameId) -> void {
+        if (logic(gameId) == nullptr) return;
+        lockGame(gameId);
+        GameState& state = states[gameId];
+        if (!state.isGameOver() && !deadlines->armed(gameId)) {
+            int turn = state.getTurn();
+            char tag[32];
+            logPrint(LogLevel::Warn, "%s[ Deadline ] P%d 턴 기한 초과 -> %s", tagOf(gameId, tag, sizeof(tag)), turn,
+                     onTimeout == TurnTimeout::Forfeit ? "기권 패" : "대신 이동");
+            if (onTimeout == TurnTimeout::AutoMove) {
+                applyLocked(gameId, turn, Bot::bestMove(state.getNumber()));
+            } else {
+                logics[gameId].forfeit(turn);
+                finished(gameId);
+                notify(gameId, state, turn, 0);
+            }
+        }
+        unlockGame(gameId);
+    }
+
+    // 범위를 벗어난 게임 id는 nullptr
+    auto logic(int gameId) -> GameLogic* {
+        if (gameId < 0 || gameId >= size()) return nullptr;
+        return &logics[gameId];
+    }
+
+    // 이동 반영 + 결과 브로드캐스트 (턴 검증은 GameState, 범위를 벗어난 게임 id 는 Ignored)
+    // 외친 개수는 전송과 무관하게 여기서 한 번 검증 -> 범위 밖이면 반영 / 저널 기록 없이 BadCount
+    auto apply(int gameId, int playerId, int cnt) -> MoveResult {
+        if (logic(gameId) == nullptr) return MoveResult::Ignored;
+        if (cnt < 1 || cnt > MAX_PER_TURN) {
+            char tag[32];
+            logPrint(LogLevel::Warn, "%s[ logic ] 외친 개수 범위 밖 P%d cnt=%d", tagOf(gameId, tag, sizeof(tag)), playerId, cnt);
+            return MoveResult::BadCount;
+        }
+        lockGame(gameId);
+        MoveResult r = applyLocked(gameId, playerId, cnt);
+        unlockGame(gameId);
+        return r;
+    }
+
+    // 외부 종료 요청 : 진행 중인 모든 게임에 게임오버 플래그 설정 (관찰자에게도 알림)
+    auto finishAll() -> void {
+        for (int i = 0; i < size(); ++i) {
+            lockGame(i);
+            if (!states[i].isGameOver()) {
+                states[i].setGameOver("");
+                if (deadlines != nullptr) deadlines->cancel(i);
+                notify(i, states[i], 0, 0);
+            }
+            unlockGame(i);
+        }
+    }
+
+    // 배치 하나의 이동을 그룹 커밋 (다른 수신 스레드의 append 와 겹치지 않게)
+    auto commitJournal() -> void {
+        if (!journal.isOpen()) return;
+        if (concurrent) pthread_mutex_lock(&journalLock);
+        journal.commit();
+        if (concurrent) pthread_mutex_unlock(&journalLock);
+    }
+
+    // 모든 게임이 끝날 때까지 최대 timeout 대기 (시그널이면 EINTR 로 바로 반환) -> 끝났으면 true
+    auto waitFinished(const timespec* timeout) -> bool {
+        uint32_t left = remaining.load(memory_order_acquire);
+        if (left == 0) return true;
+        futexWait(&remaining, left, timeout);
+        return remaining.load(memory_order_acquire) == 0;
+    }
+};
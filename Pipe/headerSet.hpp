@@ -15,20 +15,90 @@
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <errno.h>
+#include <atomic>
+#include <cstdint>
+#include <climits>
+#include "../Common/turnRing.hpp"
+#include "../Common/shmRecovery.hpp"
+#include "../Common/instance.hpp"
+#include "../Common/turnDoorbell.hpp"
 
 using namespace std;
 
-#define SHM_KEY 60019
-#define SEM_KEY_01 60018
-#define SEM_KEY_02 60017
-// #define MSG_KEY 60014
+// IPC 키 / 경로는 인스턴스별 (../Common/instance.hpp : 인스턴스 0 이면 아래 값 그대로)
+#define SHM_KEY Instance::key(60019)
+#define SEM_KEY_01 Instance::key(60018)
+#define SEM_KEY_02 Instance::key(60017)
+#define MSG_KEY Instance::key(60014) // br31_server 메시지 큐 전송 : 요청 큐 (모든 플레이어 -> 서버)
+#define MSG_REPLY_KEY Instance::key(60013) // 응답 큐 (서버 -> 플레이어, mtype 으로 받을 플레이어 구분)
 #define MAX_NUM 31
-#define PIPE_PATH "/tmp/br31_server_fifo"
+#define MAX_PER_TURN 3 // 한 턴에 이어서 외칠 수 있는 최대 개수
+#define PIPE_PATH Instance::path("/tmp/br31_server_fifo")
+#define SOCK_PATH Instance::path("/tmp/br31_server.sock") // br31_server 소켓 전송 (SOCK_SEQPACKET, 레코드 형식은 FIFO 와 동일)
+#define MAX_GAMES 16384 // 서버 하나가 호스팅하는 최대 게임 슬롯 수 (세그먼트 크기 고정)
+#define PIPE_SHM_LAYOUT 2 // SharedTable 레이아웃 버전 (필드를 바꾸면 올림 -> 옛 세그먼트에 재부착하지 않음)
 
-// struct MsgQueue {
-//     long msg_type;
-//     char msg_text[100];
-// }; // message queue 구조체
+// FIFO / 소켓 레코드 (고정 크기 바이너리, 리틀 엔디언 호스트 간 로컬 IPC 전용)
+#define MOVE_PROTO_VERSION 2
+#define MOVE_BATCH 256 // 서버가 read() 한 번에 꺼내는 최대 레코드 수
+#define REPLY_PATH_FMT "/tmp/br31_client_%d_fifo" // 세션별 응답 FIFO (클라이언트 pid)
+
+enum RecordType : uint16_t {
+    REC_CONNECT = 1,    // 세션 연결 요청 (pid, game_id, player_id)
+    REC_MOVE = 2,       // 이동 (session_id, cnt, seq)
+    REC_DISCONNECT = 3  // 세션 종료 (session_id)
+};
+
+struct MoveRecord {
+    uint16_t version;    // MOVE_PROTO_VERSION
+    uint16_t type;       // RecordType
+    uint16_t player_id;  // 외친 플레이어 1 ~ MAX_PLAYERS (REC_CONNECT)
+    uint16_t cnt;        // 이번 턴에 외친 숫자 개수 (REC_MOVE)
+    uint32_t game_id;    // 게임 슬롯 번호 (REC_CONNECT)
+    uint32_t seq;        // 클라이언트별 전송 순번
+    uint32_t session_id; // 서버가 발급한 세션 id (REC_MOVE, REC_DISCONNECT)
+    int32_t pid;         // 클라이언트 pid -> 응답 FIFO 경로 (REC_CONNECT)
+}; // 클라이언트 -> 서버 FIFO 메시지 구조체
+
+enum ReplyStatus : int16_t {
+    REPLY_OK = 0,          // 연결 수락 / 이동 반영
+    REPLY_WRONG_TURN = 1,  // 현재 턴이 아님
+    REPLY_GAME_OVER = 2,   // 게임 종료 (이번 이동으로 종료된 경우 포함)
+    REPLY_REJECTED = 3     // 잘못된 세션 / 게임 id / 외친 개수
+};
+
+struct ReplyRecord {
+    uint16_t version;    // MOVE_PROTO_VERSION
+    int16_t status;      // ReplyStatus
+    uint32_t session_id;
+    uint32_t seq;        // 응답 대상 레코드의 seq
+    int32_t number;      // 처리 후 현재 숫자
+    int32_t turn;        // 처리 후 현재 턴
+}; // 서버 -> 클라이언트 응답 FIFO 메시지 구조체
+
+static_assert(sizeof(MoveRecord) == 24, "MoveRecord layout is part of the wire protocol");
+static_assert(sizeof(ReplyRecord) == 20, "ReplyRecord layout is part of the wire protocol");
+static_assert(sizeof(ReplyRecord) <= PIPE_BUF, "ReplyRecord write must stay atomic on a FIFO");
+static_assert(sizeof(MoveRecord) <= PIPE_BUF, "MoveRecord write must stay atomic on a FIFO");
+
+// 메시지 큐 메시지 (br31_server --transport msgq) : FIFO / 소켓과 같은 레코드 앞에 mtype 만 붙임
+// mtype = 플레이어 주소 (게임 id / 플레이어 id 로 정해짐) : 요청은 보낸 플레이어, 응답은 받을 플레이어
+// 서버는 요청 큐에서 아무 mtype 이나 도착 순서대로, 클라이언트는 응답 큐에서 자기 mtype 만 꺼냄 (1 은 서버 깨우기용)
+#define MSGQ_WAKE_TYPE 1L
+
+inline auto msgqPlayerType(uint32_t gameId, int playerId) -> long {
+    return MSGQ_WAKE_TYPE + 1 + (long)gameId * MAX_PLAYERS + (playerId - 1);
+}
+
+struct MsgRequest {
+    long mtype; // msgqPlayerType(게임, 플레이어) -> 서버는 레코드가 아니라 이 값으로 게임 / 플레이어를 정함
+    MoveRecord rec;
+}; // 클라이언트 -> 서버 메시지
+
+struct MsgReply {
+    long mtype; // 요청의 mtype 그대로
+    ReplyRecord rec;
+}; // 서버 -> 클라이언트 메시지
 
 struct SharedData {
     int current_num; // 현재 숫자
@@ -36,4 +106,17 @@ struct SharedData {
     int current_cnt; // 클라이언트가 외친 숫자의 개수
     char last_caller[20];
     bool gameover;
+    TurnRing turn_ring; // 턴 순서 (서버가 게임 시작 시 초기화, 이후 읽기 전용)
+    atomic<uint64_t> state_word; // lock-free GameState 전용 : number | turn | cnt | gameover 패킹
+    MoveIntent intent; // 반영 중인 이동 (서버 재시작 시 반쯤 반영된 이동 복구)
+    TurnSignal turn_signal; // 턴 교대 / 종료마다 서버가 올림 -> 클라이언트는 폴링 대신 futex 로 자기 차례를 기다림
+}; // 게임 슬롯 하나의 상태
+
+static_assert(atomic<uint64_t>::is_always_lock_free, "state_word must be lock-free to live in shared memory");
+
+struct SharedTable {
+    ShmHeader header; // magic / 레이아웃 버전 / 서버 세대 (웜 재시작 검증)
+    int game_count; // 서버가 활성화한 게임 수 (0 ~ MAX_GAMES)
+    uint32_t session_hwm; // 지금까지 발급한 가장 큰 세션 id (재시작 후 이 이하는 기존 클라이언트 몫으로 남겨 둠)
+    SharedData games[MAX_GAMES]; // 게임 id로 인덱싱되는 슬롯 테이블
 }; // 공유 메모리 구조체
\ No newline at end of file
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "headerSet.hpp"
+#include "../Common/pacing.hpp"
+#include <poll.h>
+
+// [ SRP ] 클라이언트 측 세션 계층
+// 연결 시 한 번만 서버 FIFO / 응답 FIFO를 열고 게임이 끝날 때까지 유지 (이동마다 open/close 없음)
+// watchRestart 로 공유 메모리 헤더를 넘기면 서버 웜 재시작(--recover)을 따라감
+// : 서버가 없는 동안 전송은 FIFO를 다시 열며 대기, 응답 대기 중 세대가 바뀌면 restarted() 로 알림
+class PipeSession {
+    int serverFd = -1;
+    int replyFd = -1;
+    uint32_t sessionId = 0;
+    uint32_t seq = 0;
+    int replyId;        // 응답 FIFO 경로 식별자 (기본 pid, 한 프로세스에 세션이 여러 개면 호출자가 지정)
+    char replyPath[64];
+    int gameId = 0;
+    int playerId = 0;
+    volatile sig_atomic_t* stopFlag = nullptr;
+    const ShmHeader* header = nullptr; // 서버 세대 감시 (nullptr -> 재시작을 따라가지 않음)
+    uint64_t generation = 0;
+    bool restartSeen = false;
+
+    // 서버가 살아 있거나 재시작을 기다리는 중 (정상 종료한 서버는 owner_pid 를 0 으로 지움)
+    auto serverExpected() -> bool {
+        return header != nullptr && __atomic_load_n(&header->owner_pid, __ATOMIC_ACQUIRE) != 0
+            && (stopFlag == nullptr || !*stopFlag);
+    }
+
+    // 레코드마다 게임 / 플레이어 / pid 를 함께 실어 재시작한 서버가 세션을 복구할 수 있게 함
+    auto send(MoveRecord rec) -> bool {
+        rec.version = MOVE_PROTO_VERSION;
+        rec.session_id = sessionId;
+        rec.seq = ++seq;
+        rec.game_id = (uint32_t)gameId;
+        rec.player_id = (uint16_t)playerId;
+        rec.pid = (int32_t)replyId;
+        while (write(serverFd, &rec, sizeof(rec)) != (ssize_t)sizeof(rec)) {
+            if (errno != EPIPE || !serverExpected()) return false;
+            // 읽는 서버가 없음 -> 재시작한 서버가 FIFO를 열 때까지 다시 열기 시도
+            close(serverFd);
+            while ((serverFd = open(PIPE_PATH, O_WRONLY | O_NONBLOCK)) == -1) {
+                if (!serverExpected()) return false;
+                paceSleep(Pacing::get().pollUs);
+            }
+            fcntl(serverFd, F_SETFL, fcntl(serverFd, F_GETFL) & ~O_NONBLOCK);
+        }
+        return true;
+    }
+
+    // 응답 FIFO에서 방금 보낸 레코드의 응답을 대기 (시그널로 중단 / 서버 재시작이면 false)
+    // seq 가 다른 응답은 재시작 전에 보낸 레코드의 늦은 응답이므로 버림
+    auto receive(ReplyRecord& reply) -> bool {
+        while (true) {
+            if (header != nullptr) {
+                pollfd pfd{replyFd, POLLIN, 0};
+                int n = poll(&pfd, 1, 100);
+                if (n == 0) {
+                    uint64_t g = shmGeneration(*header);
+                    if (g != generation) {
+                        generation = g;
+                        restartSeen = true;
+                        return false;
+                    }
+                    if (!serverExpected()) return false;
+                    continue;
+                }
+                if (n == -1) return false;
+            }
+            ssize_t n = read(replyFd, &reply, sizeof(reply));
+            if (n != (ssize_t)sizeof(reply) || reply.version != MOVE_PROTO_VERSION) return false;
+            if (reply.seq == seq) return true;
+        }
+    }
+public:
+    explicit PipeSession(int id = (int)getpid()) : replyId{id} {
+        snprintf(replyPath, sizeof(replyPath), REPLY_PATH_FMT, replyId);
+    }
+
+    auto id() -> uint32_t { return sessionId; }
+
+    auto watchRestart(const ShmHeader* h) -> void {
+        header = h;
+        generation = shmGeneration(*h);
+    }
+
+    // 직전 응답 대기가 서버 재시작으로 끊겼는지 (확인하면 지움)
+    auto restarted() -> bool {
+        bool r = restartSeen;
+        restartSeen = false;
+        return r;
+    }
+
+    // 서버 FIFO가 생길 때까지 대기 후 연결, 세션 id 발급받으면 true
+    auto connect(int game, int player, volatile sig_atomic_t& stop) -> bool {
+        gameId = game;
+        playerId = player;
+        stopFlag = &stop;
+        signal(SIGPIPE, SIG_IGN); // 서버가 먼저 종료해도 write 에러로 처리
+        if (mkfifo(replyPath, 0600) == -1 && errno != EEXIST) { perror("mkfifo ( reply )"); return false; }
+        // O_RDWR : 서버가 열기 전에도 블록되지 않고, 서버가 닫아도 EOF가 나지 않음
+        replyFd = open(replyPath, O_RDWR);
+        if (replyFd == -1) { perror("open ( reply )"); return false; }
+
+        while (!stop && (serverFd = open(PIPE_PATH, O_WRONLY | O_NONBLOCK)) == -1) {
+            paceSleep(Pacing::get().pollUs);
+        }
+        if (stop) return false;
+        int flags = fcntl(serverFd, F_GETFL);
+        fcntl(serverFd, F_SETFL, flags & ~O_NONBLOCK);
+
+        MoveRecord rec{};
+        rec.type = REC_CONNECT;
+        rec.player_id = (uint16_t)playerId;
+        rec.game_id = (uint32_t)gameId;
+        rec.pid = (int32_t)replyId;
+        ReplyRecord reply{};
+        if (!send(rec) || !receive(reply) || reply.status != REPLY_OK) return false;
+        sessionId = reply.session_id;
+        return true;
+    }
+
+    // 이동 전송만 (응답은 awaitReply 로 따로 수신)
+    auto submitMove(int cnt) -> bool {
+        MoveRecord rec{};
+        rec.type = REC_MOVE;
+        rec.cnt = (uint16_t)cnt;
+        return send(rec);
+    }
+
+    auto awaitReply(ReplyRecord& reply) -> bool { return receive(reply); }
+
+    // 이동 전송 후 서버의 처리 결과를 응답 채널에서 수신
+    auto sendMove(int cnt, ReplyRecord& reply) -> bool {
+        return submitMove(cnt) && receive(reply);
+    }
+
+    auto disconnect() -> void {
+        if (serverFd != -1 && sessionId != 0) {
+            MoveRecord rec{};
+            rec.type = REC_DISCONNECT;
+            send(rec);
+        }
+        sessionId = 0;
+        if (serverFd != -1) close(serverFd);
+        if (replyFd != -1) close(replyFd);
+        serverFd = replyFd = -1;
+        unlink(replyPath);
+    }
+
+    ~PipeSession() { disconnect(); }
+};
@@ -0,0 +1,114 @@
+#include "headerSet.hpp"
+#include "pipeSession.hpp"
+#include "../Common/benchStats.hpp"
+#include "../Common/shmMutex.hpp"
+#include "../Common/commonOptions.hpp"
+#include <sys/wait.h>
+
+// [ SRP ] FIFO 전송 벤치마크 드라이버
+// pipe_server 를 띄우고 게임마다 플레이어 스레드 N개(-p, 기본 2)가 세션으로 대국을 진행하며
+// 제출 -> 반영(공유 메모리에 턴 교대가 보일 때까지), 턴 인계 지연과 초당 이동 수를 측정
+
+volatile sig_atomic_t stop_requested = 0;
+
+struct BenchGame {
+    SharedData* shared;
+    int gameId;
+    atomic<uint64_t> lastApplyNs{0}; // 직전 이동의 반영을 제출자가 확인한 시각
+    atomic<uint64_t> moves{0};
+};
+
+struct PlayerArgs {
+    BenchGame* game;
+    int playerId;
+    LatencyHistogram submit;
+    LatencyHistogram handoff;
+};
+
+static void* playerThread(void* arg) {
+    PlayerArgs* p = reinterpret_cast<PlayerArgs*>(arg);
+    SharedData* shared = p->game->shared;
+    PipeSession session((int)getpid() * (MAX_PLAYERS + 1) + p->playerId);
+    if (!session.connect(p->game->gameId, p->playerId, stop_requested)) {
+        cerr << "[ Bench ] 세션 연결 실패 P" << p->playerId << endl;
+        return nullptr;
+    }
+
+    uint64_t myLast = 0; // 내가 마지막으로 기록한 lastApplyNs
+    while (true) {
+        benchSpinUntil([&] { return shmLoad(shared->gameover) || shmLoad(shared->current_turn) == p->playerId; });
+        if (shmLoad(shared->gameover)) break;
+        uint64_t seen = benchNowNs(), sample = 0;
+        if (p->game->moves.load() > 0 && benchHandoffSample(p->game->lastApplyNs, myLast, seen, sample)) p->handoff.record(sample);
+
+        int before = shmLoad(shared->current_num);
+        int cnt = min(2, MAX_NUM - before);
+        uint64_t t0 = benchNowNs();
+        if (!session.submitMove(cnt)) break;
+        // 턴이 아니라 숫자 변화로 반영을 확인 (코어가 하나면 상대가 이미 한 수를 더 둬 턴이 내게 돌아와 있을 수 있음)
+        benchSpinUntil([&] { return shmLoad(shared->gameover) || shmLoad(shared->current_num) != before; });
+        uint64_t t1 = benchNowNs();
+        p->submit.record(t1 - t0);
+        p->game->lastApplyNs.store(t1, memory_order_release);
+        myLast = t1;
+        p->game->moves.fetch_add(1, memory_order_relaxed);
+
+        ReplyRecord reply{};
+        if (!session.awaitReply(reply) || reply.status == REPLY_GAME_OVER) break;
+    }
+    session.disconnect();
+    return nullptr;
+}
+
+int main(int argc, char* argv[]) {
+    // --instance / --cpus 는 벤치가 띄우는 서버에도 (환경 변수로) 그대로 적용
+    if (!configureCommon(argc, argv, OPT_INSTANCE)) return 1;
+    BenchOptions opt;
+    if (!opt.parse(argc, argv) || opt.games > MAX_GAMES || opt.players > MAX_PLAYERS) {
+        cerr << "usage: " << argv[0] << " [-g games] [-p players] [--csv file] [--json file]" << endl;
+        return 1;
+    }
+
+    string games = to_string(opt.games), players = to_string(opt.players);
+    char* serverArgv[] = {(char*)"./pipe_server", (char*)games.c_str(), (char*)players.c_str(), nullptr};
+    pid_t server = spawnBenchServer(serverArgv);
+    if (server == -1) { perror("fork"); return 1; }
+
+    // 서버가 FIFO를 만들 때까지 대기 (FIFO는 공유 메모리 초기화 이후에 생성됨)
+    while (access(PIPE_PATH, F_OK) == -1) usleep(10000);
+    int shmId = shmget(SHM_KEY, sizeof(SharedTable), 0666);
+    if (shmId == -1) { perror("shmget ( bench )"); return 1; }
+    SharedTable* table = (SharedTable*)shmat(shmId, nullptr, 0);
+    if (table == (void*)-1) { perror("shmat ( bench )"); return 1; }
+
+    BenchResult result;
+    result.transport = "fifo";
+    result.games = opt.games;
+    result.players = opt.players;
+
+    uint64_t start = benchNowNs();
+    for (int g = 0; g < opt.games; ++g) {
+        BenchGame game;
+        game.shared = &table->games[g];
+        game.gameId = g;
+        vector<PlayerArgs> players(opt.players);
+        vector<pthread_t> threads(opt.players);
+        for (int i = 0; i < opt.players; ++i) {
+            players[i].game = &game;
+            players[i].playerId = i + 1;
+            pthread_create(&threads[i], nullptr, playerThread, &players[i]);
+        }
+        for (int i = 0; i < opt.players; ++i) {
+            pthread_join(threads[i], nullptr);
+            result.submit.merge(players[i].submit);
+            result.handoff.merge(players[i].handoff);
+        }
+        result.moves += game.moves.load();
+    }
+    result.seconds = (benchNowNs() - start) / 1e9;
+
+    shmdt(table);
+    waitpid(server, nullptr, 0);
+    opt.report(result);
+    return 0;
+}
@@ -1,13 +1,22 @@
 #include "headerSet.hpp"
+#include "pipeSession.hpp"
+#include "../Common/pacing.hpp"
+#include "../Common/strategyTable.hpp"
+#include "../Common/shmMutex.hpp"
+#include "../Common/commonOptions.hpp"
 #include <signal.h>
 
 volatile sig_atomic_t stop_requested = 0;
 
+using Bot = StrategyTable<MAX_NUM, MAX_PER_TURN>; // 현재 숫자 -> 외칠 개수 (컴파일 시간 표 조회)
+
+static const timespec TURN_WAIT{1, 0}; // 턴 알림 대기 한 번의 최대 길이
+
 void handle_sigint(int) {
     stop_requested = 1;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     // 시그널 핸들러 등록
     struct sigaction sa{};
     sa.sa_handler = handle_sigint;
@@ -16,68 +25,73 @@ int main() {
     sigaction(SIGINT, &sa, nullptr);
     sigaction(SIGTERM, &sa, nullptr);
 
-    int shmId = shmget(SHM_KEY, sizeof(SharedData), 0666);
+    // 실행 인자 : [--pace normal|turbo|배율] 참가할 게임 id (기본 0) 플레이어 번호 (기본 1, 3인 이상 게임에서 지정)
+    if (!configureCommon(argc, argv)) return 1;
+    int gameId = (argc > 1) ? atoi(argv[1]) : 0;
+    int playerId = (argc > 2) ? atoi(argv[2]) : 1;
+    if (gameId < 0 || gameId >= MAX_GAMES) { cerr << "invalid game id" << endl; return 1; }
+    if (playerId < 1 || playerId > MAX_PLAYERS) { cerr << "invalid player id" << endl; return 1; }
+
+    int shmId = shmget(SHM_KEY, sizeof(SharedTable), 0666);
     while (shmId == -1) {
         perror("shmget 대기 중");
         sleep(1);
-        shmId = shmget(SHM_KEY, sizeof(SharedData), 0666);
+        shmId = shmget(SHM_KEY, sizeof(SharedTable), 0666);
     }
     if (shmId == -1) { perror("shmget ( client )"); return 1; }
-    SharedData* shared = (SharedData*)shmat(shmId, nullptr, 0);
-    if (shared == (void*)-1) { perror("shmat ( client )"); return 1; }
-
-    int moves[] = {1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 21, 22, 25, 26, 29, 30};
-    int moveCnt = sizeof(moves) / sizeof(moves[0]);
+    SharedTable* table = (SharedTable*)shmat(shmId, nullptr, 0);
+    if (table == (void*)-1) { perror("shmat ( client )"); return 1; }
+    SharedData* shared = &table->games[gameId];
 
     cout.flush();
 
-    for (int i = 0; i < moveCnt; i += 2) {
-        if (shared->gameover) break;
+    // 세션 연결 (서버 FIFO / 응답 FIFO는 게임이 끝날 때까지 열린 상태 유지)
+    PipeSession session;
+    session.watchRestart(&table->header); // 서버가 --recover 로 재시작하면 이어서 진행
+    if (!session.connect(gameId, playerId, stop_requested)) {
+        if (!stop_requested) cerr << "[ Client P" << playerId << " ] 세션 연결 실패" << endl;
+        shmdt(table);
+        return 1;
+    }
 
-        // 턴 대기: current_turn == 1 일 때까지 대기
-        while (!shared->gameover && shared->current_turn != 1) {
-            usleep(50000);
+    // 턴 순서는 서버의 TurnRing 이 정하므로 플레이어 수와 관계없이 게임이 끝날 때까지 반복
+    // 공유 메모리는 서버만 쓰고 클라이언트는 잠금 없이 원자 읽기만 (외친 개수는 MoveRecord 로 전달)
+    while (!shmLoad(shared->gameover)) {
+        // 턴 대기: current_turn == playerId 일 때까지 턴 알림(futex)으로 잠듦 (폴링 없음)
+        // 알림 번호를 먼저 읽고 턴 확인 -> 그 사이 턴이 바뀌었으면 잠들지 않음, 1초마다 종료 요청 / 서버 재시작 확인
+        while (!shmLoad(shared->gameover) && !stop_requested) {
+            uint32_t seen = shared->turn_signal.seq.load(memory_order_acquire);
+            if (shmLoad(shared->current_turn) == playerId || shmLoad(shared->gameover)) break;
+            turnSignalWait(shared->turn_signal, seen, &TURN_WAIT);
         }
-        if (shared->gameover) break;
+        if (stop_requested) break;
+        if (shmLoad(shared->gameover)) break;
 
-        // 두 개의 숫자 외침
-        int cnt = 0;
-        for (int j = 0; j < 2 && (i + j) < moveCnt; j++) {
-            if (shared->gameover) break;
-            
-            // 클라이언트가 외친 숫자 및 외친 개수 기록 (출력 형식은 세마포어 클라이언트와 동일)
-            shared->current_cnt = 2;
-            cnt++;
-            cout.flush();
-            usleep(300000);
-        }
+        // 전략 표에서 현재 숫자에 맞는 개수를 골라 외침 (고민하는 텀 한 번)
+        int cnt = Bot::bestMove(shmLoad(shared->current_num));
+        paceSleep(Pacing::get().thinkUs);
 
-        // 메시지 전송: "playerId cnt"
-        // FIFO가 준비될 때까지 대기
-        while (!stop_requested && access(PIPE_PATH, F_OK) == -1) {
-            usleep(100000);
-        }
+        // 메시지 전송: 세션으로 MoveRecord 한 개 전송 후 응답 채널에서 처리 결과 수신
+        // (응답이 오면 턴 교대까지 끝난 상태이므로 턴 변경을 폴링할 필요 없음)
         if (stop_requested) break;
-        int fd = open(PIPE_PATH, O_WRONLY);
-        if (fd != -1) {
-            char buf[64];
-            snprintf(buf, sizeof(buf), "%d %d", 1, cnt);
-            write(fd, buf, strlen(buf)+1);
-            close(fd);
+        ReplyRecord reply{};
+        if (!session.sendMove(cnt, reply)) {
+            if (session.restarted()) continue; // 응답 전에 서버 재시작 -> 복구된 상태에서 턴 다시 확인
+            break;
         }
+        if (reply.status == REPLY_GAME_OVER) break;
 
-        // 중요: 턴이 바뀔 때까지 대기 (동기화)
-        int prevTurn = shared->current_turn;
-        while (!shared->gameover && shared->current_turn == prevTurn) {
-            usleep(50000);
-        }
-
-        usleep(200000);
+        paceSleep(Pacing::get().turnEndUs);
     }
 
-    while (!shared->gameover && !stop_requested) usleep(100000);
+    session.disconnect();
+    while (!shmLoad(shared->gameover) && !stop_requested) {
+        uint32_t seen = shared->turn_signal.seq.load(memory_order_acquire);
+        if (shmLoad(shared->gameover)) break;
+        turnSignalWait(shared->turn_signal, seen, &TURN_WAIT);
+    }
     cout.flush();
 
-    shmdt(shared);
+    shmdt(table);
     return 0;
 }
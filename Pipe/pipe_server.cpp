@@ -1,179 +1,95 @@
 #include "headerSet.hpp"
-
-pthread_mutex_t print_lock = PTHREAD_MUTEX_INITIALIZER;
-
-void safePrint(const string& msg) {
-    pthread_mutex_lock(&print_lock);
-    cout << msg << endl;
-    cout.flush();
-    pthread_mutex_unlock(&print_lock);
-}
-
-// [ SRP ] 게임 상태 관리
-class GameState {
-    SharedData* data;
-    pthread_mutex_t lock;
-public:
-    explicit GameState(SharedData* ptr) : data{ptr} {
-        pthread_mutex_init(&lock, nullptr);
-    }
-    
-    auto getCnt() -> int {
-        pthread_mutex_lock(&lock);
-        int c = data->current_cnt;
-        pthread_mutex_unlock(&lock);
-        return c;
-    }
-    
-    auto isGameOver() -> bool {
-        pthread_mutex_lock(&lock);
-        bool over = data->gameover;
-        pthread_mutex_unlock(&lock);
-        return over;
-    }
-    
-    auto getNumber() -> int {
-        pthread_mutex_lock(&lock);
-        int n = data->current_num;
-        pthread_mutex_unlock(&lock);
-        return n;
-    }
-    
-    auto getTurn() -> int {
-        pthread_mutex_lock(&lock);
-        int t = data->current_turn;
-        pthread_mutex_unlock(&lock);
-        return t;
-    }
-    
-    auto getCaller() -> string {
-        pthread_mutex_lock(&lock);
-        string s = data->last_caller;
-        pthread_mutex_unlock(&lock);
-        return s;
-    }
-    
-    auto updateNumber(int cnt, int callerId) -> void {
-        pthread_mutex_lock(&lock);
-        for (int i = 0; i < cnt; ++i) {
-            data->current_num++;
-            safePrint("[ Client P" + to_string(callerId) + " ] 외친 숫자 = " + to_string(data->current_num));
-            usleep(250000);
-        }
-        pthread_mutex_unlock(&lock);
-    }
-    
-    auto switchTurn() -> void {
-        pthread_mutex_lock(&lock);
-        data->current_turn = (data->current_turn == 1 ? 2 : 1);
-        pthread_mutex_unlock(&lock);
-    }
-    
-    auto setGameOver(const string& caller) -> void {
-        pthread_mutex_lock(&lock);
-        data->gameover = true;
-        strncpy(data->last_caller, caller.c_str(), sizeof(data->last_caller));
-        pthread_mutex_unlock(&lock);
-    }
-    
-    ~GameState() {
-        pthread_mutex_destroy(&lock);
-    }
-};
-
-// [ SRP ] 게임 규칙 적용
-class GameLogic {
-    GameState& state;
-public:
-    explicit GameLogic(GameState& s) : state{s} {}
-    
-    GameState& getState() { return state; }
-    
-    void applyMove(int playerId, int cnt) {
-        if (state.isGameOver()) return;
-        if (playerId != state.getTurn()) {
-            safePrint("[ logic ] 잘못된 턴 접근 P" + to_string(playerId));
-            return;
-        }
-        
-        state.updateNumber(cnt, playerId);
-        
-        if (state.getNumber() >= MAX_NUM) {
-            state.setGameOver("P" + to_string(playerId));
-            safePrint("[ Result ] GAME OVER ( 패배한 클라이언트 -> P" + to_string(playerId) + "!! )");
-            return;
-        }
-        
-        state.switchTurn();
-    }
-};
-
-// [ SRP ] 브로드캐스터 (매번 상태 출력)
-class Broadcaster {
-    GameState& state;
-public:
-    explicit Broadcaster(GameState& s) : state{s} {}
-    
-    void broadcast() {
-        safePrint("[ Broadcast ] ( 턴 교체 -> 다음 턴 P" + to_string(state.getTurn()) + " )");
-    }
-};
-
-// 클라이언트 신호 수신 (메인 스레드에서 처리)
-class PipeReceiver {
-    int pipeFd;
-    GameLogic& logic;
-public:
-    PipeReceiver(int fd, GameLogic& gl) : pipeFd{fd}, logic{gl} {}
-    
-    bool readMessage(int& playerId, int& cnt) {
-        char buf[128];
-        memset(buf, 0, sizeof(buf));
-        ssize_t n = read(pipeFd, buf, sizeof(buf));
-        
-        if (n > 0) {
-            sscanf(buf, "%d %d", &playerId, &cnt);
-            return true;
-        }
-        return false;
-    }
-};
+#include "gameCore.hpp"
+#include "gameTable.hpp"
+#include "fifoDispatch.hpp"
+#include "serverSetup.hpp"
+#include "../Common/asyncLogger.hpp"
+#include "../Common/pacing.hpp"
+#include "../Common/commonOptions.hpp"
+
+// GameTable 은 gameTable.hpp, PipeReceiver / SessionTable / ReplyQueue / EventWaiter / FifoDispatcher 는 fifoDispatch.hpp,
+// 세그먼트 준비 / 시작 배너는 serverSetup.hpp (모두 br31_server 와 공용)
+// 턴 교체 / 결과 출력은 GameTable, 관전 알림은 GameTable 관찰자(관전 채널) 몫
 
 volatile sig_atomic_t stop_requested = 0;
+int signal_pipe[2] = {-1, -1}; // self-pipe : 시그널 핸들러 -> epoll 깨우기
 
 void handle_sigint(int) {
     stop_requested = 1;
+    int saved = errno;
+    char c = 1;
+    (void)!write(signal_pipe[1], &c, 1);
+    errno = saved;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
     cout.tie(nullptr);
     setvbuf(stdout, NULL, _IONBF, 0);
 
-    // IPC 초기화
-    int shmId = shmget(SHM_KEY, sizeof(SharedData), 0666 | IPC_CREAT);
-    if (shmId == -1) { perror("shmget"); return 1; }
-    SharedData* shared = (SharedData*)shmat(shmId, nullptr, 0);
-    if (shared == (void*)-1) { perror("shmat"); return 1; }
-    memset(shared, 0, sizeof(SharedData));
-    shared->current_turn = 0;
+    // 실행 인자 : [--pace normal|turbo|배율] [--instance N] [--cpus 목록|auto] [--journal 디렉터리 [--durable]] [--recover] [--turn-timeout 초] [--on-timeout forfeit|move]
+    //            동시에 진행할 게임 수 (기본 1) 게임당 플레이어 수 (기본 2)
+    if (!configureCommon(argc, argv)) return 1;
+    JournalOptions journalOpt;
+    journalOpt.configure(argc, argv);
+    bool recover = recoverRequested(argc, argv);
+    DeadlineOptions deadlineOpt;
+    if (!deadlineOpt.configure(argc, argv)) {
+        cerr << "invalid turn deadline ( --turn-timeout <seconds> --on-timeout forfeit|move )" << endl;
+        return 1;
+    }
+    int gameCount = (argc > 1) ? atoi(argv[1]) : 1;
+    int playerCount = (argc > 2) ? atoi(argv[2]) : 2;
+    if (gameCount < 1 || gameCount > MAX_GAMES || playerCount < 2 || playerCount > MAX_PLAYERS) {
+        cerr << "usage: " << argv[0] << " [games 1~" << MAX_GAMES << "] [players 2~" << MAX_PLAYERS << "]" << endl;
+        return 1;
+    }
+
+    // IPC 초기화 (--recover : 이전 서버의 세그먼트가 유효하면 초기화 없이 재부착)
+    GameSegment segment;
+    if (!segment.attach(recover, gameCount, playerCount)) return 1;
+    SharedTable* shared = segment.shared;
+    bool reattached = segment.reattached;
+    gameCount = segment.games;
+    playerCount = segment.players;
 
     // FIFO 준비
     if (mkfifo(PIPE_PATH, 0666) == -1 && errno != EEXIST) { perror("mkfifo"); }
     int pipeFd = open(PIPE_PATH, O_RDONLY | O_NONBLOCK);
     if (pipeFd == -1) { perror("open fifo"); return 1; }
+    // 서버가 쓰기 끝을 하나 잡아 두어 클라이언트가 모두 close 해도 EOF(EPOLLHUP)가 반복되지 않게 함
+    int keepAliveFd = open(PIPE_PATH, O_WRONLY | O_NONBLOCK);
+    if (keepAliveFd == -1) { perror("open fifo ( keep-alive )"); return 1; }
+
+    // 턴 기한 : timerfd 를 FIFO / 시그널과 같은 epoll 에 등록 (가장 이른 기한 하나에만 맞춰 둠)
+    TurnDeadlines deadlines;
+    if (!deadlines.open(gameCount, deadlineOpt.timeoutNs(), true)) return 1;
+
+    if (pipe2(signal_pipe, O_NONBLOCK | O_CLOEXEC) == -1) { perror("pipe2"); return 1; }
+    EventWaiter waiter(pipeFd, signal_pipe[0], deadlines.fd());
+    if (!waiter.valid()) return 1;
 
-    GameState state(shared);
-    GameLogic logic(state);
-    Broadcaster bc(state);
-    PipeReceiver receiver(pipeFd, logic);
+    // 이동 저널 (--journal 지정 시, 게임 시작 레코드부터 기록)
+    MoveJournal journal;
+    if (journalOpt.dir != nullptr && !journal.open(journalOpt, reattached)) return 1;
 
-    safePrint("============================");
-    safePrint("[ Server ] BR31 Server Start!!");
-    safePrint("============================");
+    GameTable games(shared, gameCount, playerCount, journal, !reattached);
+    games.attachDeadlines(deadlines, deadlineOpt.policy, reattached);
+    PipeReceiver receiver(pipeFd);
+    FifoDispatcher dispatcher(games, &shared->session_hwm, reattached, journal.isOpen() && journalOpt.durable);
 
-    int number = 0;
+    segment.logStart("", games, journal, journalOpt, deadlines, deadlineOpt);
+
+    // 메트릭 (br31_stat -t pipe 로 조회), 메인 스레드가 유일한 기록자
+    ServerMetrics metrics;
+    metrics.open(METRICS_KEY_PIPE);
+    MetricsSlot& mainMetrics = metrics.claim("main");
+
+    // 관전 채널 (br31_watch -t pipe 로 조회) : 이동 / 턴 교대 / 종료를 한 번씩 발행
+    SpectatorChannel spectators;
+    spectators.open(SPECTATOR_KEY_PIPE);
+    games.attachSpectators(spectators);
 
     // 시그널 핸들러 등록 (Ctrl+C 등)
     struct sigaction sa{};
@@ -183,63 +99,61 @@ int main() {
     sigaction(SIGINT, &sa, nullptr);
     sigaction(SIGTERM, &sa, nullptr);
 
-    // 메인 스레드 루프: 서버가 먼저 턴을 알리고 클라이언트가 응답하도록 턴 단위 처리
-    int turn = 1;
-    while (number < MAX_NUM && !stop_requested) {
-        // 서버가 턴 알림(프롬프트)을 먼저 출력
-        safePrint("[    Pipe   ] ( 신호 감지 -> 턴 진행 P" + to_string(turn) + " )");
-        /* assign shared turn directly so clients observe server prompt then act */
-        shared->current_turn = turn;
-
-        // 해당 턴의 클라이언트 메시지를 기다림
-        int playerId = 0, cnt = 0;
-        while (!stop_requested) {
-            if (receiver.readMessage(playerId, cnt)) {
-                if (playerId != turn) {
-                    safePrint("[ logic ] 잘못된 턴 접근 P" + to_string(playerId));
-                    continue;
-                }
-                logic.applyMove(playerId, cnt);
-                break;
-            }
-            usleep(100000);
+    // 메인 스레드 루프: 도착한 메시지를 게임 id로 슬롯에 배정해 턴 단위 처리
+    // 각 슬롯의 current_turn 은 시작 시 P1, 이후 GameLogic::applyMove 가 교대
+    MoveRecord batch[MOVE_BATCH];
+    while (games.unfinished() > 0 && !stop_requested) {
+        int n = receiver.readBatch(batch, MOVE_BATCH);
+        if (n == 0) {
+            uint64_t waitStart = metricsNowNs();
+            bool readable = waiter.wait();
+            mainMetrics.add(M_WAKEUPS);
+            mainMetrics.record(H_WAIT_NS, metricsNowNs() - waitStart);
+            if (!readable) break;
+            if (waiter.timerExpired()) deadlines.expire([&games](int id) { games.expireTurn(id); });
+            continue;
         }
+        mainMetrics.add(M_RECORDS_READ, (uint64_t)n);
+        mainMetrics.record(H_BATCH, (uint64_t)n);
+        dispatcher.dispatch(batch, n);
+        if (deadlines.overdue()) deadlines.expire([&games](int id) { games.expireTurn(id); });
+    }
 
-        if (state.isGameOver() || stop_requested) break;
-
-        // 턴을 클리어하여 클라이언트가 다음 프롬프트 전에 외치지 않도록 함
-        shared->current_turn = 0;
-
-        // 브로드캐스트 및 상태 갱신
-        int nextTurn = (turn == 1 ? 2 : 1);
-        safePrint("[ Broadcast ] ( 턴 교체 -> 다음 턴 P" + to_string(nextTurn) + " )");
-        number = state.getNumber();
-
-        // 다음 턴
-        turn = nextTurn;
-        usleep(300000);
+    // --recover 로 실행 중 외부 종료 요청 -> 상태 보존 (세그먼트 / FIFO 유지, 클라이언트는 재시작을 기다림)
+    if (stop_requested && recover) {
+        logPrint(LogLevel::Info, "[ Server ] 종료 요청 - 상태 보존 ( --recover 로 다시 시작하면 이어서 진행 )");
+        journal.close();
+        segment.release(true);
+        close(keepAliveFd);
+        close(pipeFd);
+        close(signal_pipe[0]);
+        close(signal_pipe[1]);
+        logShutdown();
+        return 0;
     }
 
     // 게임 종료 or 외부 요청
     if (stop_requested) {
-        // 외부 시그널로 종료 요청이 들어오면 게임오버 플래그 설정
+        // 외부 시그널로 종료 요청이 들어오면 진행 중인 모든 게임에 게임오버 플래그 설정
         // main 스레드에서 안전하게 설정
-        safePrint("[ Server ] SIGINT/SIGTERM 수신 - 종료 처리 시작");
-        // last caller may not be meaningful here
-        shared->gameover = true;
+        logPrint(LogLevel::Info, "[ Server ] SIGINT/SIGTERM 수신 - 종료 처리 시작");
+        games.finishAll();
     }
 
-    safePrint("[ Broadcast ] 패배한 클라이언트 프로세스 : " + state.getCaller());
-
     // IPC 정리
-    shmdt(shared);
-    shmctl(shmId, IPC_RMID, nullptr);
+    if (journal.isOpen()) logPrint(LogLevel::Info, "[ Journal ] 레코드 %u 개 기록", journal.lastSeq());
+    journal.close();
+    segment.release(false);
+    metrics.remove();
+    spectators.remove();
+    close(keepAliveFd);
     close(pipeFd);
+    close(signal_pipe[0]);
+    close(signal_pipe[1]);
     unlink(PIPE_PATH);
-    safePrint("[ Server ] IPC 리소스 정리 완료");
-
-    // 모든 관련 프로세스(클라이언트 포함)에 SIGINT를 보내 종료를 유도
-    kill(0, SIGINT);
+    logPrint(LogLevel::Info, "[ Server ] IPC 리소스 정리 완료");
+    logShutdown();
 
+    // 클라이언트는 게임오버 플래그 / owner_pid = 0 을 보고 스스로 종료 (프로세스 그룹에 시그널을 보내지 않음)
     return 0;
 }
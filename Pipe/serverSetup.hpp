@@ -0,0 +1,75 @@
+#pragma once // 서버 공통 준비 : 게임 슬롯 세그먼트 부착 / 재부착, 시작 배너, 종료 정리 (pipe_server / br31_server 공통)
+
+#include "gameTable.hpp"
+
+// [ SRP ] 게임 슬롯 세그먼트 (SharedTable) 수명 관리
+// --recover 면 이전 서버의 세그먼트가 유효할 때 초기화 없이 재부착 -> 게임 / 플레이어 수는 인자가 아니라 세그먼트 값
+// 시작 배너(인스턴스 / 재부착 / 저널 / 턴 기한)도 여기서 -> 서버마다 같은 형식
+class GameSegment {
+    int shmId = -1;
+    double attachStart = 0;
+
+    static auto monotonicMs() -> double {
+        timespec ts{};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+    }
+public:
+    SharedTable* shared = nullptr;
+    bool reattached = false;
+    int games = 0;
+    int players = 0;
+
+    // 세그먼트 준비, 실패하면 false (원인은 shmAttach 가 출력)
+    auto attach(bool recover, int gameCount, int playerCount) -> bool {
+        attachStart = monotonicMs();
+        ShmAttach result = shmAttach(SHM_KEY, PIPE_SHM_LAYOUT, recover, shmId, shared);
+        if (result == ShmAttach::Failed) return false;
+        reattached = result == ShmAttach::Reattached;
+        if (reattached) {
+            if (gameCount != shared->game_count) {
+                logPrint(LogLevel::Warn, "[ Recover ] 게임 수 인자 %d 무시 -> 세그먼트의 %d 개 사용", gameCount, shared->game_count);
+            }
+            games = shared->game_count;
+            players = shared->games[0].turn_ring.players;
+        } else {
+            shared->game_count = gameCount;
+            games = gameCount;
+            players = playerCount;
+        }
+        return true;
+    }
+
+    // 시작 배너 (detail : 제목 괄호 안 게임 / 플레이어 수 뒤에 덧붙일 내용, 없으면 "")
+    auto logStart(const char* detail, GameTable& table, MoveJournal& journal, const JournalOptions& journalOpt,
+                  TurnDeadlines& deadlines, const DeadlineOptions& deadlineOpt) -> void {
+        logPrint(LogLevel::Info, "============================");
+        logPrint(LogLevel::Info, "[ Server ] BR31 Server Start!! ( games = %d, players = %d%s )", games, players, detail);
+        if (Instance::id() != 0) {
+            logPrint(LogLevel::Info, "[ Instance ] %d ( SHM 키 0x%x, %s, CPU %d 개 )", Instance::id(), (unsigned)SHM_KEY, PIPE_PATH,
+                     Instance::cpuCount());
+        }
+        if (reattached) {
+            logPrint(LogLevel::Info, "[ Recover ] 세대 %llu 재부착 ( 진행 중 %d / %d 게임, 복구한 이동 %d, %.2fms )",
+                     (unsigned long long)shared->header.generation, table.unfinished(), games, table.repairedCount(),
+                     monotonicMs() - attachStart);
+        }
+        if (journal.isOpen()) {
+            logPrint(LogLevel::Info, "[ Journal ] %s%s", journalOpt.dir, journalOpt.durable ? " ( durable : 그룹 커밋 msync )" : "");
+        }
+        if (deadlines.enabled()) {
+            logPrint(LogLevel::Info, "[ Deadline ] 턴 기한 %.1f초 ( 초과 시 %s )", deadlineOpt.seconds, deadlineOpt.policyName());
+        }
+        logPrint(LogLevel::Info, "============================");
+    }
+
+    // preserve : 분리만 (--recover 로 다시 시작한 서버가 이어받음)
+    // 아니면 정상 종료 표시(owner_pid = 0 -> 클라이언트가 재시작을 기다리지 않음) 후 분리 / 삭제
+    auto release(bool preserve) -> void {
+        if (shared == nullptr) return;
+        if (!preserve) __atomic_store_n(&shared->header.owner_pid, 0, __ATOMIC_RELEASE);
+        shmdt(shared);
+        if (!preserve) shmctl(shmId, IPC_RMID, nullptr);
+        shared = nullptr;
+    }
+};
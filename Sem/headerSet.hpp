@@ -15,25 +15,41 @@
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <errno.h>
+#include <atomic>
+#include <cstdint>
+#include <climits>
+#include "../Common/futex.hpp"
+#include "../Common/turnRing.hpp"
+#include "../Common/shmRecovery.hpp"
+#include "../Common/instance.hpp"
+#include "../Common/shmMutex.hpp"
+#include "../Common/turnDoorbell.hpp"
+#include "../Common/shmRing.hpp" // RingSegment / ringPush (RING_SHM_KEY, RING_SHM_LAYOUT)
 
 using namespace std;
 
-#define SHM_KEY 60011
-#define SEM_KEY_01 60012
-#define SEM_KEY_02 60013
-// #define MSG_KEY 60014
+// IPC 키 / 경로는 인스턴스별 (../Common/instance.hpp : 인스턴스 0 이면 아래 값 그대로)
+#define SHM_KEY Instance::key(60011)
+#define SEM_KEY Instance::key(60012) // 플레이어별 세마포어 집합 하나 (멤버 playerId - 1)
 #define MAX_NUM 31
-#define PIPE_PATH "/tmp/br31_server_fifo"
-
-// struct MsgQueue {
-//     long msg_type;
-//     char msg_text[100];
-// }; // message queue 구조체
+#define MAX_PER_TURN 3 // 한 턴에 이어서 외칠 수 있는 최대 개수
+#define PIPE_PATH Instance::path("/tmp/br31_server_fifo")
+#define SEM_SHM_LAYOUT 5  // SharedData 레이아웃 버전 (필드를 바꾸면 올림 -> 옛 세그먼트에 재부착하지 않음)
 
 struct SharedData {
+    ShmHeader header; // magic / 레이아웃 버전 / 서버 세대 (웜 재시작 검증)
+    pthread_mutex_t lock; // 프로세스 공유 robust 뮤텍스 (서버 / 클라이언트 모두 이 잠금으로 상태 변경)
     int current_num; // 현재 숫자
     int current_turn; // 현재 턴
-    int current_cnt; // 클라이언트가 외친 숫자의 개수
+    int current_cnt; // 마지막으로 반영된 이동의 외친 개수
+    uint32_t proposal; // 클라이언트가 제안한 이동 : playerId << 16 | 제안할 때의 숫자 << 8 | cnt (한 번에 기록 -> 반쯤 쓴 제안 없음, 0 -> 제안 없음)
     char last_caller[20];
     bool gameover;
-}; // 공유 메모리 구조체
\ No newline at end of file
+    TurnRing turn_ring; // 턴 순서 (서버가 시작 시 초기화, 이후 읽기 전용)
+    MoveIntent intent; // 반영 중인 이동 (서버 재시작 시 반쯤 반영된 이동 복구)
+    uint32_t handoff; // 턴 인계 방식 (SemHandoff, 서버가 초기화를 마친 뒤 기록 -> 0 이면 준비 전)
+    DoorbellSet doorbell; // futex 인계용 플레이어별 초인종
+    TurnSignal turn_signal; // 숫자 / 턴 / 종료 / 인계 방식이 바뀔 때마다 서버가 올림 -> 클라이언트는 폴링 대신 futex 로 기다림
+    TurnSignal proposal_signal; // 클라이언트가 제안을 기록할 때마다 올림 -> 서버는 턴 주인의 제안을 폴링 없이 기다림
+    uint32_t last_move[MAX_PLAYERS]; // 플레이어별 마지막으로 반영된 이동 (proposal 과 같은 형식, cnt = 실제로 외친 개수)
+}; // 공유 메모리 구조체
@@ -0,0 +1,309 @@
+#include "headerSet.hpp"
+#include "sharedGame.hpp"
+#include "../Common/benchStats.hpp"
+#include "../Common/serverMetrics.hpp"
+#include "../Common/commonOptions.hpp"
+#include <sys/wait.h>
+
+// [ SRP ] 세마포어 / 공유 메모리 링 전송 벤치마크 드라이버
+// -m sem  : sem_server --handoff sem, 플레이어 스레드가 세마포어 집합의 자기 멤버 P 로 턴을 받음 (제출 경로 없음)
+// -m futex : sem_server --handoff futex, 같은 흐름을 세그먼트 안의 초인종으로 (syscalls/move = 서버 V / wake + 클라이언트 P / wait)
+// -m pingpong-sem | pingpong-futex : 서버 없이 턴 인계 원시 연산만 측정
+//   플레이어 스레드 N개가 턴 순서대로 차례를 넘김 (게임 하나 = PINGPONG_PASSES 번), turn_handoff = 넘긴 시각 -> 다음 플레이어가 받은 시각
+//   세마포어 모드 서버는 페이싱으로 턴을 진행해 (turbo 면 플레이어를 기다리지 않음) 인계 비용이 드러나지 않으므로 따로 측정
+//   -> make bench 는 pingpong 두 모드로만 인계를 비교, -m sem / futex 결과는 transport 가 "... (paced e2e)"
+// -m ring : sem_server ring, 플레이어 스레드가 링에 push 후 턴 교대가 보일 때까지 대기
+// 게임마다 서버를 새로 띄워 순차 진행
+
+struct BenchGame {
+    SharedData* shared;
+    RingSegment* rings;                // ring 모드에서만 사용
+    atomic<uint64_t> lastApplyNs{0};   // 직전 턴이 끝난 것을 확인한 시각
+    atomic<uint64_t> moves{0};
+    atomic<uint64_t> syscalls{0};      // 플레이어 스레드의 대기 시스템 콜 (semop P / FUTEX_WAIT)
+};
+
+struct PlayerArgs {
+    BenchGame* game;
+    int playerId;
+    bool ring;
+    LatencyHistogram submit;
+    LatencyHistogram handoff;
+};
+
+static auto recordHandoff(PlayerArgs* p, uint64_t myLast, uint64_t seen) -> void {
+    uint64_t sample = 0;
+    if (benchHandoffSample(p->game->lastApplyNs, myLast, seen, sample)) p->handoff.record(sample);
+}
+
+// 내 차례 신호 받기 : 세마포어 P (매번 시스템 콜) / 초인종 (토큰이 이미 있으면 원자 연산뿐)
+static auto takeTurn(SharedData* shared, int semId, int playerId, uint64_t& syscalls) -> bool {
+    if (semId == -1) return doorbellTake(shared->doorbell, playerId, nullptr, &syscalls) == DoorbellTake::Taken;
+    sembuf pop{};
+    pop.sem_num = (unsigned short)(playerId - 1); // 집합 안의 내 멤버
+    pop.sem_op = -1;
+    while (true) {
+        ++syscalls;
+        if (semop(semId, &pop, 1) == 0) return true;
+        if (errno != EINTR) return false; // EIDRM : 서버가 게임을 마치고 세마포어 제거
+    }
+}
+
+static void* semPlayerThread(void* arg) {
+    PlayerArgs* p = reinterpret_cast<PlayerArgs*>(arg);
+    SharedData* shared = p->game->shared;
+    int semId = -1;
+    if (shmLoad(shared->handoff) == HANDOFF_SEM && (semId = semget(SEM_KEY, 0, 0666)) == -1) return nullptr;
+
+    uint64_t myLast = 0; // 내가 마지막으로 기록한 lastApplyNs
+    uint64_t syscalls = 0;
+    SharedGame game(shared);
+    while (!shmLoad(shared->gameover)) {
+        if (!takeTurn(shared, semId, p->playerId, syscalls)) break;
+        recordHandoff(p, myLast, benchNowNs());
+        p->game->moves.fetch_add(1, memory_order_relaxed);
+
+        // 서버는 턴 주인의 제안을 기다림 -> 바로 2개 제안 (기한까지 기다리는 시간이 재는 값에 섞이지 않게)
+        int from = shmLoad(shared->current_num);
+        game.propose(p->playerId, from, min(2, MAX_NUM - from));
+
+        // 서버가 이번 턴을 끝내고 다음 플레이어로 넘길 때까지 (current_turn 변경)
+        benchSpinUntil([&] { return shmLoad(shared->gameover) || shmLoad(shared->current_num) >= MAX_NUM || shmLoad(shared->current_turn) != p->playerId; });
+        myLast = benchNowNs();
+        p->game->lastApplyNs.store(myLast, memory_order_release);
+    }
+    p->game->syscalls.fetch_add(syscalls, memory_order_relaxed);
+    return nullptr;
+}
+
+static void* ringPlayerThread(void* arg) {
+    PlayerArgs* p = reinterpret_cast<PlayerArgs*>(arg);
+    RingView& view = p->game->rings->view; // 링 클라이언트는 링 세그먼트의 view 만 읽음
+    ShmRing* ring = &p->game->rings->rings[p->playerId - 1];
+    uint64_t myLast = 0; // 내가 마지막으로 기록한 lastApplyNs
+    auto over = [&] { return view.gameover.load(memory_order_relaxed) != 0; };
+
+    while (true) {
+        benchSpinUntil([&] { return over() || view.turn.load(memory_order_acquire) == p->playerId; });
+        if (over()) break;
+        if (p->game->moves.load() > 0) recordHandoff(p, myLast, benchNowNs());
+
+        int before = view.number.load(memory_order_relaxed);
+        RingMove mv{p->playerId, min(2, MAX_NUM - before)};
+        uint64_t t0 = benchNowNs();
+        while (!ringPush(ring, mv)) sched_yield();
+        // 턴이 아니라 숫자 변화로 반영을 확인 (코어가 하나면 상대가 이미 한 수를 더 둬 턴이 내게 돌아와 있을 수 있음)
+        benchSpinUntil([&] { return over() || view.number.load(memory_order_relaxed) != before; });
+        uint64_t t1 = benchNowNs();
+        p->submit.record(t1 - t0);
+        p->game->lastApplyNs.store(t1, memory_order_release);
+        myLast = t1;
+        p->game->moves.fetch_add(1, memory_order_relaxed);
+    }
+    return nullptr;
+}
+
+static constexpr int PINGPONG_PASSES = 10000;
+
+// 핑퐁 : 세마포어 집합 / 초인종은 IPC_PRIVATE 로 만들어 서버 세그먼트와 섞이지 않게
+struct PingPong {
+    bool futex;
+    int players;
+    int semId = -1;
+    DoorbellSet* bell = nullptr;
+    atomic<int64_t> remaining{0};
+    atomic<uint64_t> passNs{0};
+    atomic<uint64_t> syscalls{0};
+};
+
+struct PingPongArgs {
+    PingPong* pp;
+    int playerId;
+    LatencyHistogram handoff;
+};
+
+static auto pingPongPass(PingPong& pp, int playerId, uint64_t& syscalls) -> void {
+    if (pp.futex) {
+        if (doorbellRing(*pp.bell, playerId)) ++syscalls;
+        return;
+    }
+    sembuf v{};
+    v.sem_num = (unsigned short)(playerId - 1);
+    v.sem_op = 1;
+    semop(pp.semId, &v, 1);
+    ++syscalls;
+}
+
+static void* pingPongThread(void* arg) {
+    PingPongArgs* a = reinterpret_cast<PingPongArgs*>(arg);
+    PingPong& pp = *a->pp;
+    int next = a->playerId % pp.players + 1;
+    uint64_t syscalls = 0;
+    while (true) {
+        bool taken;
+        if (pp.futex) {
+            taken = doorbellTake(*pp.bell, a->playerId, nullptr, &syscalls) == DoorbellTake::Taken;
+        } else {
+            sembuf pop{};
+            pop.sem_num = (unsigned short)(a->playerId - 1);
+            pop.sem_op = -1;
+            ++syscalls;
+            taken = semop(pp.semId, &pop, 1) == 0 || errno == EINTR;
+        }
+        if (!taken) break;
+        uint64_t now = benchNowNs();
+        if (pp.remaining.fetch_sub(1, memory_order_relaxed) <= 0) {
+            // 마지막 인계까지 끝남 -> 나머지 플레이어의 대기를 풂
+            if (pp.futex) doorbellClose(*pp.bell);
+            else semctl(pp.semId, 0, IPC_RMID);
+            break;
+        }
+        a->handoff.record(now - pp.passNs.load(memory_order_acquire));
+        pp.passNs.store(benchNowNs(), memory_order_release);
+        pingPongPass(pp, next, syscalls);
+    }
+    pp.syscalls.fetch_add(syscalls, memory_order_relaxed);
+    return nullptr;
+}
+
+static auto playPingPong(bool futex, int games, int playerCount, BenchResult& result) -> bool {
+    PingPong pp;
+    pp.futex = futex;
+    pp.players = playerCount;
+    int shmId = -1;
+    if (futex) {
+        shmId = shmget(IPC_PRIVATE, sizeof(DoorbellSet), 0600 | IPC_CREAT);
+        if (shmId == -1) { perror("shmget ( pingpong )"); return false; }
+        pp.bell = (DoorbellSet*)shmat(shmId, nullptr, 0);
+        shmctl(shmId, IPC_RMID, nullptr); // 분리되면 회수
+        if (pp.bell == (void*)-1) { perror("shmat ( pingpong )"); return false; }
+    } else {
+        pp.semId = semget(IPC_PRIVATE, playerCount, 0600 | IPC_CREAT);
+        if (pp.semId == -1) { perror("semget ( pingpong )"); return false; }
+        vector<unsigned short> zeros(playerCount, 0);
+        semctl(pp.semId, 0, SETALL, zeros.data());
+    }
+    pp.remaining.store((int64_t)games * PINGPONG_PASSES);
+
+    vector<PingPongArgs> args(playerCount);
+    vector<pthread_t> threads(playerCount);
+    for (int i = 0; i < playerCount; ++i) {
+        args[i].pp = &pp;
+        args[i].playerId = i + 1;
+        pthread_create(&threads[i], nullptr, pingPongThread, &args[i]);
+    }
+    uint64_t syscalls = 0;
+    pp.passNs.store(benchNowNs());
+    pingPongPass(pp, 1, syscalls);
+    for (int i = 0; i < playerCount; ++i) {
+        pthread_join(threads[i], nullptr);
+        result.handoff.merge(args[i].handoff);
+    }
+    result.moves += (uint64_t)games * PINGPONG_PASSES;
+    result.syscalls += pp.syscalls.load() + syscalls;
+    if (futex) shmdt(pp.bell);
+    return true;
+}
+
+// 서버 메트릭 세그먼트의 시스템 콜 카운터 합계 (서버의 턴 인계 semop V / FUTEX_WAKE)
+static auto serverSyscalls(const MetricsBlock* block) -> uint64_t {
+    if (block == nullptr) return 0;
+    uint64_t sum = 0;
+    uint32_t used = block->slots_used.load(memory_order_acquire);
+    for (uint32_t i = 0; i < used && i < METRICS_MAX_THREADS; ++i) sum += block->slots[i].counters[M_SYSCALLS].load(memory_order_relaxed);
+    return sum;
+}
+
+// 서버 하나를 띄워 게임 한 판을 진행하고 결과를 result 에 누적
+// handoff : 세마포어 모드의 턴 인계 (sem | futex), ring 이면 무시
+static auto playOneGame(bool ring, const char* handoff, int playerCount, BenchResult& result) -> bool {
+    string players = to_string(playerCount);
+    vector<char*> serverArgv = {(char*)"./sem_server"};
+    if (ring) serverArgv.push_back((char*)"ring");
+    else serverArgv.insert(serverArgv.end(), {(char*)"--handoff", (char*)handoff});
+    serverArgv.push_back((char*)players.c_str());
+    serverArgv.push_back(nullptr);
+    pid_t server = spawnBenchServer(serverArgv.data());
+    if (server == -1) { perror("fork"); return false; }
+
+    // 서버 IPC 준비 대기 (세마포어 모드 : 공유 메모리 -> 인계 방식 기록, 링 모드 : 링 세그먼트)
+    int shmId = -1;
+    if (ring) {
+        while (shmget(RING_SHM_KEY, sizeof(RingSegment), 0666) == -1) usleep(1000);
+        usleep(10000); // 서버의 memset / view 공개가 끝난 뒤 접속
+        shmId = shmget(SHM_KEY, sizeof(SharedData), 0666);
+    } else {
+        while ((shmId = shmget(SHM_KEY, sizeof(SharedData), 0666)) == -1) usleep(1000);
+    }
+    if (shmId == -1) { perror("shmget ( bench )"); return false; }
+
+    BenchGame game;
+    game.shared = (SharedData*)shmat(shmId, nullptr, 0);
+    game.rings = nullptr;
+    if (!ring) {
+        while (shmLoad(game.shared->handoff) == HANDOFF_NONE) usleep(1000);
+    }
+    int metricsId = shmget(METRICS_KEY_SEM, 0, 0);
+    const MetricsBlock* metrics = metricsId == -1 ? nullptr : (const MetricsBlock*)shmat(metricsId, nullptr, SHM_RDONLY);
+    if (metrics == (void*)-1) metrics = nullptr;
+    if (ring) game.rings = (RingSegment*)shmat(shmget(RING_SHM_KEY, sizeof(RingSegment), 0666), nullptr, 0);
+
+    vector<PlayerArgs> args(playerCount);
+    vector<pthread_t> threads(playerCount);
+    for (int i = 0; i < playerCount; ++i) {
+        args[i].game = &game;
+        args[i].playerId = i + 1;
+        args[i].ring = ring;
+        pthread_create(&threads[i], nullptr, ring ? ringPlayerThread : semPlayerThread, &args[i]);
+    }
+    for (int i = 0; i < playerCount; ++i) {
+        pthread_join(threads[i], nullptr);
+        result.submit.merge(args[i].submit);
+        result.handoff.merge(args[i].handoff);
+    }
+    result.moves += game.moves.load();
+
+    shmdt(game.shared);
+    if (game.rings != nullptr) shmdt(game.rings);
+    waitpid(server, nullptr, 0);
+    if (!ring) result.syscalls += game.syscalls.load() + serverSyscalls(metrics);
+    if (metrics != nullptr) shmdt(metrics);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    // --instance / --cpus 는 벤치가 띄우는 서버에도 (환경 변수로) 그대로 적용
+    if (!configureCommon(argc, argv, OPT_INSTANCE)) return 1;
+    BenchOptions opt;
+    if (!opt.parse(argc, argv) || opt.players > MAX_PLAYERS) {
+        cerr << "usage: " << argv[0] << " [-m sem|futex|ring|pingpong-sem|pingpong-futex] [-g games] [-p players] [--csv file] [--json file]" << endl;
+        return 1;
+    }
+    const char* mode = opt.mode != nullptr ? opt.mode : "sem";
+    bool pingPong = strncmp(mode, "pingpong-", 9) == 0;
+    const char* handoff = pingPong ? mode + 9 : mode;
+    if (strcmp(handoff, "sem") != 0 && strcmp(handoff, "futex") != 0 && (pingPong || strcmp(mode, "ring") != 0)) {
+        cerr << "unknown mode : " << mode << endl;
+        return 1;
+    }
+    bool ring = strcmp(mode, "ring") == 0;
+
+    // sem / futex 대국 전체는 서버의 턴 처리가 지배 -> 인계 비교로 읽히지 않게 이름에 표시 (make bench 에서는 실행하지 않음)
+    BenchResult result;
+    result.transport = pingPong || ring ? string(mode) : string(mode) + " (paced e2e)";
+    result.games = opt.games;
+    result.players = opt.players;
+
+    uint64_t start = benchNowNs();
+    if (pingPong) {
+        if (!playPingPong(strcmp(handoff, "futex") == 0, opt.games, opt.players, result)) return 1;
+    } else {
+        for (int g = 0; g < opt.games; ++g) {
+            if (!playOneGame(ring, mode, opt.players, result)) return 1;
+        }
+    }
+    result.seconds = (benchNowNs() - start) / 1e9;
+
+    opt.report(result);
+    return 0;
+}
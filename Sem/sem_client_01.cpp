@@ -1,68 +1,72 @@
 #include "headerSet.hpp"
+#include "sharedGame.hpp"
+#include "../Common/pacing.hpp"
+#include "../Common/strategyTable.hpp"
+#include "../Common/commonOptions.hpp"
 
-// [ SRP : 단일 책임 원칙 ] server.cpp에 고정된 신호 순차 전송
-// [ DIP : 의존 역전 원칙 ] server.cpp의 `SemaphoreReceiver`와만 연결
+// [ SRP : 단일 책임 원칙 ] 자기 턴에 외칠 개수를 공유 상태에 제안
+// [ DIP : 의존 역전 원칙 ] sharedGame.hpp 의 `TurnBell`(차례 신호) / `SharedGame`(상태 읽기 + 제안)과만 연결
 
-int main() {
-    int semId;
+using Bot = StrategyTable<MAX_NUM, MAX_PER_TURN>; // 현재 숫자 -> 외칠 개수 (컴파일 시간 표 조회)
+
+int main(int argc, char* argv[]) {
+    // 실행 인자 : [--pace normal|turbo|배율]
+    if (!configureCommon(argc, argv)) return 1;
+
+    int shmId;
     while (true) {
-        semId = semget(SEM_KEY_01, 1, 0666);
-        if (semId != -1) break;
-        perror("semget 대기 중");
+        shmId = shmget(SHM_KEY, sizeof(SharedData), 0666);
+        if (shmId != -1) break;
+        perror("shmget 대기 중");
         sleep(1);
     }
-    if (semId == -1) { perror("semget"); return 1; }
-
-    int shmId = shmget(SHM_KEY, sizeof(SharedData), 0666);
-    if (shmId == -1) { perror("shmget ( client )"); return 1; }
     SharedData* shared = (SharedData*)shmat(shmId, nullptr, 0);
     if (shared == (void*)-1) { perror("shmat ( client )"); return 1; }
 
-    sembuf sops{};
-    sops.sem_num = 0;
-    sops.sem_flg = 0;
+    // 차례 신호는 서버가 고른 방식으로 (세마포어 집합의 P1 멤버 / 세그먼트 안의 P1 초인종)
+    TurnBell bell(shared, 1);
+    if (!bell.open()) { shmdt(shared); return 0; }
 
-    int moves[] = {1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 21, 22, 25, 26, 29, 30};
-    int moveCnt = sizeof(moves) / sizeof(moves[0]);
+    cout << "[ SEM_Client_01 ] 시작됨 (턴 인계 : " << (bell.mode() == HANDOFF_FUTEX ? "futex" : "semaphore") << ")" << endl;
 
-    cout << "[ SEM_Client_01 ] 시작됨 (세마포어 ID : " << semId << ")" << endl;
-
-    for (int i = 0; i < moveCnt; i += 2) {
-        if (shared->gameover) break;
-
-        // 세마포어 P 연산 (서버 턴 획득)
-        sops.sem_op = -1;
-        if (semop(semId, &sops, 1) == -1) {
-            if (errno == EIDRM || errno == EINVAL) break;
-            perror("semop P");
-            break;
-        }
+    // 턴 / 숫자 / 종료는 잠금 없이 읽고, 이번 턴 개수는 세그먼트 안의 잠금으로 제안
+    SharedGame game(shared);
+    while (!game.gameOver()) {
+        // 차례 신호 받기 (세마포어 P / 초인종 가져가기)
+        if (!bell.take()) break;
 
-        // 두 개의 숫자 외침
-        for (int j = 0; j < 2 && (i + j) < moveCnt; j++) {
-            if (shared->gameover) break;
-            shared->current_cnt = 2;
+        // 세마포어 방식은 값이 외친 숫자마다 쌓이므로 실제 차례는 공유 메모리의 턴으로 확인
+        game.waitUntil([&] { return game.gameOver() || game.turn() == 1; });
+        if (game.gameOver()) break;
 
-            cout << "[ SEM_Client_01 ] 숫자 외침 : " << moves[i + j]
-                 << " (이번 턴 외친 개수: " << shared->current_cnt << ")" << endl;
+        // 전략 표에서 현재 숫자에 맞는 개수를 골라 생각한 뒤 제안 (턴 / 숫자 확인 + 기록을 잠금 한 번으로, 서버가 기다렸다가 반영)
+        int from = game.number();
+        int cnt = Bot::bestMove(from);
+        paceSleep(Pacing::get().thinkUs * cnt);
+        bool ownerDied = false;
+        Proposal proposal = game.propose(1, from, cnt, &ownerDied);
+        if (ownerDied) cout << "[ SEM_Client_01 ] 잠금을 쥔 프로세스 종료 감지 -> 상태 복구 후 진행" << endl;
+        if (proposal == Proposal::GameOver) break;
+        if (proposal == Proposal::Unavailable) { cerr << "[ SEM_Client_01 ] 공유 상태 잠금 사용 불가" << endl; break; }
+        if (proposal == Proposal::NotYourTurn) continue;
 
-            // 각 숫자마다 서버에 전달 (V 연산)
-            sops.sem_op = 1;
-            if (semop(semId, &sops, 1) == -1) {
-                if (errno == EIDRM || errno == EINVAL) break;
-                perror("semop V");
-                break;
-            }
+        // 서버가 이 이동을 기록할 때까지 대기 후 실제로 반영된 숫자만 출력
+        // (턴 변경으로 기다리면 turbo 에서 상대 턴이 끝나 다시 내 턴이 된 뒤에 깨어나 놓칠 수 있음)
+        int applied = 0;
+        game.waitUntil([&] { return (applied = game.appliedCnt(1, from)) > 0 || game.gameOver(); });
+        for (int j = 0; j < applied; j++) {
+            cout << "[ SEM_Client_01 ] 숫자 외침 : " << from + j + 1
+                 << " (이번 턴 외친 개수: " << applied << ")" << endl;
 
-            usleep(300000); // 두 숫자 사이 텀
+            // 각 숫자마다 서버에 전달 (세마포어 방식만 V 연산)
+            if (!bell.called()) break;
         }
 
-        // 턴 종료 후 대기
-        usleep(400000);
-        if (moves[i] >= MAX_NUM) break;
+        // 턴 종료 후 텀
+        paceSleep(Pacing::get().turnEndUs);
     }
 
-    while (!shared->gameover) usleep(100000);
+    game.waitUntil([&] { return game.gameOver(); });
     cout << "[ SEM_Client_01 ] 클라이언트 프로세스 P1 종료" << endl;
 
     shmdt(shared);
@@ -0,0 +1,65 @@
+#include "headerSet.hpp"
+#include "../Common/pacing.hpp"
+#include "../Common/strategyTable.hpp"
+#include "../Common/commonOptions.hpp"
+
+// [ SRP : 단일 책임 원칙 ] 자기 턴에 외칠 개수를 공유 메모리 링에 push
+// [ DIP : 의존 역전 원칙 ] 링 세그먼트(`ShmRingReceiver` + view)와만 연결 -> sem_server ring / br31_server 어느 쪽에도 접속
+
+using Bot = StrategyTable<MAX_NUM, MAX_PER_TURN>; // 현재 숫자 -> 외칠 개수 (컴파일 시간 표 조회)
+static const timespec VIEW_WAIT{1, 0}; // view 알림 대기 한 번의 최대 길이
+
+int main(int argc, char* argv[]) {
+    // 실행 인자 : [--pace normal|turbo|배율] 플레이어 번호
+    if (!configureCommon(argc, argv)) return 1;
+    int playerId = (argc > 1) ? atoi(argv[1]) : 1;
+    if (playerId < 1 || playerId > RING_PLAYERS) { cerr << "usage: " << argv[0] << " [1~" << RING_PLAYERS << "]" << endl; return 1; }
+
+    int ringShmId;
+    while (true) {
+        ringShmId = shmget(RING_SHM_KEY, sizeof(RingSegment), 0666);
+        if (ringShmId != -1) break;
+        perror("shmget ( ring ) 대기 중");
+        sleep(1);
+    }
+    RingSegment* rings = (RingSegment*)shmat(ringShmId, nullptr, 0);
+    if (rings == (void*)-1) { perror("shmat ( ring )"); return 1; }
+    ShmRing* ring = &rings->rings[playerId - 1];
+
+    // 게임 상태는 링 세그먼트의 view 에서 읽음 (서버가 sem_server ring 이든 br31_server 든 동일)
+    // 서버가 턴 순서 링을 기록하고 turn 을 공개할 때까지 대기 (view 가 바뀔 때마다 서버가 올리는 알림으로 잠듦)
+    RingView& view = rings->view;
+    auto waitView = [&](auto done) { turnSignalAwait(view.signal, done, &VIEW_WAIT); };
+    waitView([&] { return view.turn.load(memory_order_acquire) != 0; });
+
+    if (!turnRingHas(view.turn_ring, playerId)) {
+        cerr << "[ RING_Client_0" << playerId << " ] 이 게임의 플레이어 수는 " << (int)view.turn_ring.players << "명" << endl;
+        shmdt(rings);
+        return 1;
+    }
+
+    cout << "[ RING_Client_0" << playerId << " ] 시작됨" << endl;
+
+    auto over = [&] { return view.gameover.load(memory_order_relaxed) != 0; };
+    auto turn = [&] { return view.turn.load(memory_order_acquire); };
+    while (!over()) {
+        // 턴 대기
+        waitView([&] { return over() || turn() == playerId; });
+        if (over()) break;
+
+        // 전략 표에서 현재 숫자에 맞는 개수 선택
+        int before = view.number.load(memory_order_relaxed);
+        int cnt = Bot::bestMove(before);
+        RingMove mv{playerId, cnt};
+        while (!ringPush(ring, mv)) usleep(1000);
+        cout << "[ RING_Client_0" << playerId << " ] 이동 전송 (외친 개수: " << cnt << ")" << endl;
+
+        // 내 이동이 반영될 때까지 대기 (턴이 아니라 숫자 변화로 확인 -> 다른 플레이어들이 곧바로 두어 턴이 다시 내게 와도 놓치지 않음)
+        waitView([&] { return over() || view.number.load(memory_order_relaxed) != before; });
+    }
+
+    cout << "[ RING_Client_0" << playerId << " ] 클라이언트 프로세스 P" << playerId << " 종료" << endl;
+
+    shmdt(rings);
+    return 0;
+}
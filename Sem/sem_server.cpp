@@ -1,82 +1,126 @@
 #include "headerSet.hpp"
-
-pthread_mutex_t print_lock = PTHREAD_MUTEX_INITIALIZER;
-
-// 출력 순서 꼬임 문제 해결 용도로 사용하는 동기화
-void safePrint(const string& msg) {
-    pthread_mutex_lock(&print_lock);
-    cout << msg << endl;
-    pthread_mutex_unlock(&print_lock);
-}
+#include "sharedGame.hpp"
+#include "../Common/asyncLogger.hpp"
+#include "../Common/pacing.hpp"
+#include "../Common/serverMetrics.hpp"
+#include "../Common/spectatorChannel.hpp"
+#include "../Common/taskExecutor.hpp"
+#include "../Common/receiver.hpp"
+#include "../Common/ringReceiver.hpp"
+#include "../Common/commonOptions.hpp"
+#include <deque>
+
+// 출력은 ../Common/asyncLogger.hpp 의 logPrint 사용 (백그라운드 스레드가 순서대로 배치 출력)
 
 // system call -> C style
 // struct of logic -> Modern C++
 // server.cpp 코드는 Advanced IPC(공유 메모리, 세마포어), 파이프 클라이언트 모두 사용 가능
 
 // [ SRP : 단일 책임 원칙 ] 게임 상태(숫자/턴/종료)를 관리하는 역할만 담당
-// [ 캡슐화 ] 상태값(private) 접근(getter/setter), 경쟁 조건 방지(pthread_mutex)
+// [ 캡슐화 ] 상태값(private) 접근(getter/setter), 경쟁 조건 방지(세그먼트 안의 프로세스 공유 robust 뮤텍스)
+// 규칙은 sharedGame.hpp : 클라이언트도 같은 잠금으로 이동을 제안하고, 턴 / 숫자 / 종료는 잠금 없이 읽음
 class GameState {
     SharedData* data;
-    pthread_mutex_t lock;
+
+    // 잠금 주인(클라이언트 / 이전 서버)이 잠근 채 죽었으면 상태를 맞추고 기록
+    auto lock() -> ShmLock {
+        return ShmLock(data->lock, [this] {
+            bool fixed = sharedRepair(*data);
+            logPrint(LogLevel::Warn, "[ State ] 잠금을 쥔 프로세스 종료 감지 -> 잠금 회수%s", fixed ? " + 반쯤 반영된 이동 복구" : "");
+        });
+    }
 public:
-    explicit GameState(SharedData* ptr) : data{ptr} {
-        pthread_mutex_init(&lock, nullptr);
+    explicit GameState(SharedData* ptr) : data{ptr} {}
+    // 세그먼트를 새로 만들었을 때 한 번 (재부착이면 기존 잠금을 그대로 사용)
+    auto init() -> bool { return shmMutexInit(data->lock); }
+    // 턴 주인이 현재 숫자에서 제안한 개수를 꺼냄 (제안 없음 -> 0), 다른 플레이어 / 지난 숫자의 제안은 버림
+    auto takeProposal(int playerId) -> int {
+        ShmLock guard = lock();
+        uint32_t p = data->proposal;
+        if (p == 0) return 0;
+        shmStore(data->proposal, 0u);
+        if (proposalPlayer(p) != playerId || proposalFrom(p) != data->current_num) return 0;
+        int cnt = proposalCnt(p);
+        return cnt >= 1 && cnt <= MAX_PER_TURN ? cnt : 0;
     }
-    auto getCnt() -> int {
-        pthread_mutex_lock(&lock);
-        int c = data->current_cnt;
-        pthread_mutex_unlock(&lock);
-        return c;
+    // 턴 주인의 제안을 기다림 (제안 알림으로 잠듦), timeoutUs 안에 없거나 종료 요청이면 0 -> 호출자가 기본 개수 사용
+    auto awaitProposal(int playerId, uint64_t timeoutUs, volatile sig_atomic_t& stop) -> int {
+        timespec now{};
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        uint64_t deadline = (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000 + timeoutUs;
+        while (true) {
+            uint32_t seen = data->proposal_signal.seq.load(std::memory_order_acquire);
+            int cnt = takeProposal(playerId);
+            if (cnt > 0 || stop) return cnt;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            uint64_t nowUs = (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+            if (nowUs >= deadline) return 0;
+            timespec left{(time_t)((deadline - nowUs) / 1000000), (long)((deadline - nowUs) % 1000000) * 1000};
+            turnSignalWait(data->proposal_signal, seen, &left);
+        }
     }
-    auto isGameOver() -> bool {
-        pthread_mutex_lock(&lock);
-        bool over = data->gameover;
-        pthread_mutex_unlock(&lock);
-        return over;
+    // 반영한 이동 기록 (턴을 넘기기 전에 -> 클라이언트는 자기 이동이 끝났는지와 실제 개수를 읽음)
+    auto recordMove(int playerId, int from, int cnt) -> void { shmStore(data->last_move[playerId - 1], proposalPack(playerId, from, cnt)); }
+    auto isGameOver() -> bool { return shmLoad(data->gameover); }
+    auto getNumber() -> int { return shmLoad(data->current_num); }
+    auto getTurn() -> int { return shmLoad(data->current_turn); }
+    auto getCaller() -> string {
+        ShmLock guard = lock();
+        return data->last_caller;
     }
-    auto getNumber() -> int {
-        pthread_mutex_lock(&lock);
-        int n = data->current_num;
-        pthread_mutex_unlock(&lock);
+    // 숫자 하나 외침 (반환 : 외친 숫자), 숫자마다 잠금을 풀어 연출 지연 동안 클라이언트 제안이 막히지 않게 함
+    auto callNumber(int cnt) -> int {
+        ShmLock guard = lock();
+        int n = data->current_num + 1;
+        shmStore(data->current_num, n);
+        data->current_cnt = cnt;
+        turnSignalRaise(data->turn_signal);
         return n;
     }
-    auto getTurn() -> int {
-        pthread_mutex_lock(&lock);
-        int t = data->current_turn;
-        pthread_mutex_unlock(&lock);
-        return t;
-    }
-    auto getCaller() -> string {
-        pthread_mutex_lock(&lock);
-        string s = data->last_caller;
-        pthread_mutex_unlock(&lock);
-        return s;
-    }
     auto updateNumber(int cnt) -> void {
-        pthread_mutex_lock(&lock);
         for (int i = 0; i < cnt; i++) {
-            data->current_num++;
-            safePrint("[ State ] number = " + to_string(data->current_num));
-            usleep(250000);
+            logPrint(LogLevel::Info, "[ State ] number = %d", callNumber(cnt));
+            paceSleep(Pacing::get().numberUs);
         }
-        pthread_mutex_unlock(&lock);
     }
+    // 턴 교대, 남은 제안은 버림 (반영 중에 늦게 도착한 제안이 다음 턴으로 넘어가지 않게)
     auto switchTurn() -> void {
-        pthread_mutex_lock(&lock);
-        data->current_turn = (data->current_turn == 1 ? 2 : 1);
-        pthread_mutex_unlock(&lock);
+        ShmLock guard = lock();
+        shmStore(data->proposal, 0u);
+        shmStore(data->current_turn, turnRingNext(data->turn_ring, data->current_turn));
+        turnSignalRaise(data->turn_signal);
     }
+    // 턴 순서 링은 시작 후 바뀌지 않으므로 락 없이 조회
+    auto getPlayers() -> int { return data->turn_ring.players; }
     auto setGameOver(const string& caller) -> void {
-        pthread_mutex_lock(&lock);
-        data->gameover = true;
+        ShmLock guard = lock();
         strncpy(data->last_caller, caller.c_str(), sizeof(data->last_caller));
-        pthread_mutex_unlock(&lock);
+        shmStore(data->gameover, true);
+        turnSignalRaise(data->turn_signal);
+    }
+    // 이동 반영 시작 / 끝 표시 (그 사이에 서버가 죽으면 재시작 시 repair 가 마저 적용)
+    auto beginMove(int playerId, int cnt) -> void {
+        ShmLock guard = lock();
+        moveIntentBegin(data->intent, playerId, data->current_num, cnt);
     }
-    ~GameState() {
-        pthread_mutex_destroy(&lock);
+    auto endMove() -> void { moveIntentEnd(data->intent); }
+    // 웜 재시작 : 이전 서버가 남긴 반영 중인 이동을 마저 적용 (이전 서버가 잠근 채 죽었어도 잠금을 회수한 뒤)
+    auto repair() -> bool {
+        ShmLock guard = lock();
+        return moveIntentRepair(*data, MAX_NUM);
     }
 };
 
+// 메트릭 세그먼트 (br31_stat -t sem 으로 조회), 수신 스레드마다 슬롯 하나
+ServerMetrics g_metrics;
+
+// 관전 채널 (br31_watch -t sem 으로 조회), 세마포어 모드는 게임 하나 -> game 0
+SpectatorChannel g_spectators;
+
+static auto publishSpectator(SpectatorEventType type, GameState& s, int playerId, int cnt) -> void {
+    g_spectators.publish(type, 0, playerId, cnt, s.getNumber(), s.getTurn());
+}
+
 // [ SRP : 단일 책임 원칙 ] 게임 규칙만 처리(턴 검증, 숫자 갱신, 종료 판단)
 // [ DIP : 의존 역전 원칙 ] GameState 추상화에 의존(상태 관리 방법이 바뀌어도 영향 없음)
 class GameLogic {
@@ -85,220 +129,456 @@ public:
     explicit GameLogic(GameState& s) : state{s} {}
     GameState& getState() { return state; }
     void applyMove(int playerId, int cnt) {
+        MetricsSlot& metrics = *threadMetrics();
+        uint64_t started = metricsNowNs();
         if (state.isGameOver()) return;
+        if (cnt < 1 || cnt > MAX_PER_TURN) {
+            logPrint(LogLevel::Warn, "[ logic ] 외친 개수 범위 밖 P%d cnt=%d", playerId, cnt);
+            return;
+        }
         if (playerId != state.getTurn()) {
-            safePrint("[ logic ] 잘못된 턴 접근 P" + to_string(playerId));
+            metrics.add(M_WRONG_TURN);
+            logPrint(LogLevel::Warn, "[ logic ] 잘못된 턴 접근 P%d", playerId);
             return;
         }
+        metrics.add(M_MOVES_APPLIED);
+        state.beginMove(playerId, cnt);
         state.updateNumber(cnt);
         if (state.getNumber() >= MAX_NUM) {
             state.setGameOver("P" + to_string(playerId));
-            safePrint("[ logic ] GAME OVER ( 패배한 클라이언트 프로세스 -> P" + to_string(playerId) + "!! )");
+            state.endMove();
+            publishSpectator(SPEC_MOVE, state, playerId, cnt);
+            publishSpectator(SPEC_OVER, state, playerId, cnt);
+            metrics.add(M_GAMES_FINISHED);
+            metrics.record(H_APPLY_NS, metricsNowNs() - started);
+            logPrint(LogLevel::Info, "[ logic ] GAME OVER ( 패배한 클라이언트 프로세스 -> P%d!! )", playerId);
             return;
         }
         state.switchTurn();
+        state.endMove();
+        publishSpectator(SPEC_MOVE, state, playerId, cnt);
+        metrics.record(H_APPLY_NS, metricsNowNs() - started);
     }
 };
 
-// IReceiver (추상 클래스 / 인터페이스)
-class IReceiver {
-public:
-    virtual void start() = 0;
-    virtual void stop() = 0;
-    virtual ~IReceiver() = default;
-};
+// IReceiver / IMoveSink / ShmRingReceiver 는 ../Common/receiver.hpp, ../Common/ringReceiver.hpp (br31_server 와 공용)
 
-// [ OCP : 개방 폐쇄 원칙 ] -> 세마포어 IPC 기반 입력 수신 채널
-// [ SRP : 단일 책임 원칙 ] -> 세마포어를 통한 동기적 입력 수신만 담당
-class SemaphoreReceiver : public IReceiver {
-    int semId;
-    int playerId;
+// [ SRP : 단일 책임 원칙 ] -> 링 수신기와 게임 로직 연결 + 링 클라이언트용 view 갱신
+// 수신기 스레드 여럿이 반영 후 view 를 쓰므로 락 안에서 (반영 -> 상태 읽기 -> 기록) : 나중에 잡은 쪽이 항상 최신 상태를 씀
+class RingSink : public IMoveSink {
     GameLogic& logic;
-    bool running = true;
+    RingView& view;
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
 public:
-    SemaphoreReceiver(int id, int pid, GameLogic& gl) : semId{id}, playerId{pid}, logic{gl} {}
-    void start() override {
-        sembuf sops{};
-        sops.sem_num = 0;
-        sops.sem_flg = 0;
-
-        while (running) {
-            if (logic.getState().isGameOver()) break;
-
-            struct semid_ds buf;
-            if (semctl(semId, 0, IPC_STAT, &buf) == -1) {
-                safePrint("[ SemaphoreReceiver ] sem removed, exiting thread");
-                break;
-            }
-
-            // 세마포어 P 연산
-            sops.sem_op = -1;
-            if (semop(semId, &sops, 1) == -1) {
-                if (errno == EINTR) continue;
-                if (errno == EINVAL || errno == EIDRM) break;
-                perror("semop P");
-                break;
-            }
-
-            safePrint("[ Semaphore ] ( 신호 감지 -> 턴 진행 P" + to_string(playerId) + " )");
-
-            int cnt = logic.getState().getCnt();
-            logic.applyMove(playerId, cnt > 0 ? cnt : 1);
-
-            // 턴 교대 (다음 플레이어 세마포어 V 연산)
-            int nextKey = (playerId == 1 ? SEM_KEY_02 : SEM_KEY_01);
-            int nextSem = semget(nextKey, 1, 0666);
-            if (nextSem != -1) {
-                sembuf vop{};
-                vop.sem_num = 0;
-                vop.sem_op = 1;
-                vop.sem_flg = 0;
-                semop(nextSem, &vop, 1);
-            }
-
-            usleep(300000);
-        }
+    RingSink(GameLogic& l, RingView& v) : logic{l}, view{v} {}
+    auto gameOver() -> bool override { return logic.getState().isGameOver(); }
+    void submit(int playerId, int cnt) override {
+        pthread_mutex_lock(&lock);
+        logic.applyMove(playerId, cnt);
+        publishLocked();
+        pthread_mutex_unlock(&lock);
+    }
+    // 시작 / 종료 시 현재 상태를 view 에 기록 (turn_ring 은 시작 시 한 번)
+    void publish(const TurnRing* ring = nullptr) {
+        pthread_mutex_lock(&lock);
+        if (ring != nullptr) view.turn_ring = *ring;
+        publishLocked();
+        pthread_mutex_unlock(&lock);
     }
-    void stop() override {
-        running = false;
-        sembuf sop{};
-        sop.sem_num = 0;
-        sop.sem_op = 1;
-        sop.sem_flg = 0;
-        semop(semId, &sop, 1);
+    ~RingSink() { pthread_mutex_destroy(&lock); }
+private:
+    void publishLocked() {
+        GameState& s = logic.getState();
+        ringViewPublish(view, s.getNumber(), s.getTurn(), s.isGameOver());
     }
 };
 
 // [ SRP : 단일 책임 원칙 ] -> 출력 역할만 담당
+// executor 작업 : step 한 번 = 턴 확인 + 대기 (wake 로 대기 중단)
+// 관전 채널이 열려 있으면 채널의 관전자 하나로 붙어 발행마다 깨어남 (최대 broadcastUs), 없으면 broadcastUs 주기로 확인
 class Broadcaster {
     GameState& state;
-    bool running = true;
+    SpectatorChannel& channel;
+    unique_ptr<SpectatorReader> reader;
+    int lastTurn = -1;
+    atomic<uint32_t> tick{0}; // 채널이 없을 때의 대기용 futex 워드 (wake 가 값을 바꿔 대기 중단)
 public:
-    explicit Broadcaster(GameState& s) : state{s} {}
-    void stop() { running = false; }
-    void start() {
-        while (running && !state.isGameOver()) {
-            safePrint("[ Broadcast ] 다음 턴 P" + to_string(state.getTurn()));
-            usleep(350000);
+    Broadcaster(GameState& s, SpectatorChannel& ch) : state{s}, channel{ch} {
+        if (channel.isOpen()) reader.reset(new SpectatorReader(channel.segment()));
+    }
+    void wake() {
+        tick.fetch_add(1, memory_order_release);
+        futexWake(&tick);
+        if (reader) channel.wakeAll();
+    }
+    auto step(const StopToken& stop) -> TaskStep {
+        if (state.isGameOver()) return finish();
+        int turn = state.getTurn();
+        if (turn != lastTurn) {
+            logPrint(LogLevel::Info, "[ Broadcast ] 다음 턴 P%d", turn);
+            lastTurn = turn;
         }
-        if (state.isGameOver()) {
-            safePrint("[ Broadcast ] 패배한 클라이언트 프로세스 : " + state.getCaller());
+        // tick 을 먼저 읽고 토큰 확인 -> 그 사이 정지 요청이 와도 wake 가 tick 을 바꿔 대기하지 않음
+        // 채널 대기는 정지 요청과 경합하면 최대 broadcastUs 늦게 깨어남 (wakeAll 이 대기 전이었던 경우)
+        uint32_t seen = tick.load(memory_order_acquire);
+        if (!stop.stopRequested()) {
+            timespec period = waitTimeout((uint64_t)Pacing::get().broadcastUs * 1000);
+            if (reader) {
+                drain();
+                reader->wait(&period);
+            } else {
+                futexWait(&tick, seen, &period);
+            }
         }
+        // 종료 직전 깨어난 경우에도 결과 출력 (정지 후에는 다시 실행되지 않음)
+        if (state.isGameOver()) return finish();
+        return stop.stopRequested() ? TaskStep::Done : TaskStep::Yield;
+    }
+private:
+    // 이벤트 내용은 쓰지 않음 (턴은 state 에서 읽음) -> 읽은 위치만 head 까지
+    void drain() {
+        SpectatorEvent ev{};
+        uint64_t lost = 0;
+        while (reader->read(ev, lost) != SpectatorRead::Empty) {}
+    }
+    auto finish() -> TaskStep {
+        logPrint(LogLevel::Info, "[ Broadcast ] 패배한 클라이언트 프로세스 : %s", state.getCaller().c_str());
+        return TaskStep::Done;
     }
 };
 
 // [ SRP : 단일 책임 원칙 ] -> 서버 실행/스레드 관리 전담
+// 수신기 / 브로드캐스터를 TaskExecutor 작업으로 등록, 종료 시 정지 토큰 + 기한 있는 join
+// 워커가 작업보다 적으면 수신기는 RECEIVER_SLICE_NS 까지만 대기하고 양보 (워커를 돌려 가며 사용)
 class ServerApp {
     GameState& state;
     GameLogic& logic;
     Broadcaster& bc;
     vector<IReceiver*> receivers;
+    TaskExecutor executor;
+    static constexpr uint64_t RECEIVER_SLICE_NS = 1000000; // 1ms
 public:
-    ServerApp(GameState& s, GameLogic& l, Broadcaster& b) : state{s}, logic{l}, bc{b} {}
+    static constexpr int SHUTDOWN_DEADLINE_MS = 2000;
+
+    ServerApp(GameState& s, GameLogic& l, Broadcaster& b, const ExecutorOptions& opt)
+        : state{s}, logic{l}, bc{b}, executor{opt} {}
     void addReceiver(IReceiver* r) { receivers.emplace_back(r); }
-    static void* receiverThread(void* arg) {
-        reinterpret_cast<IReceiver*>(arg)->start();
-        return nullptr;
-    }
-    static void* bcThread(void* arg) {
-        reinterpret_cast<Broadcaster*>(arg)->start();
-        return nullptr;
-    }
     void run() {
-        safePrint("============================");
-        safePrint("[ Server ] BR31 Server Start!!");
-        safePrint("============================");
-
-        for (auto& r : receivers) {
-            pthread_t t{};
-            pthread_create(&t, nullptr, receiverThread, r);
-            pthread_detach(t);
+        logPrint(LogLevel::Info, "============================");
+        logPrint(LogLevel::Info, "[ Server ] BR31 Server Start!!");
+        logPrint(LogLevel::Info, "============================");
+
+        int tasks = (int)receivers.size() + 1;
+        int threads = executor.start(tasks);
+        uint64_t waitNs = threads < tasks ? RECEIVER_SLICE_NS : 0;
+        logPrint(LogLevel::Info, "[ Server ] 작업 %d 개 / 워커 스레드 %d 개%s", tasks, threads,
+                 waitNs > 0 ? " ( 수신기 1ms 단위 양보 )" : "");
+
+        for (size_t i = 0; i < receivers.size(); ++i) {
+            IReceiver* r = receivers[i];
+            executor.submit("receiver P" + to_string(i + 1),
+                            [r, waitNs](const StopToken& stop) { return r->poll(stop, waitNs); },
+                            [r] { r->wake(); });
         }
 
-        sleep(2);
-        pthread_t bt{};
-        pthread_create(&bt, nullptr, bcThread, &bc);
-        pthread_detach(bt);
+        paceSleep(Pacing::get().startupUs);
+        executor.submit("broadcaster", [this](const StopToken& stop) { return bc.step(stop); }, [this] { bc.wake(); });
     }
 
-    void stopAll() {
-        for (auto r : receivers) r->stop();
-        bc.stop();
-        safePrint("[ Server ] 모든 스레드 종료 요청 완료");
+    // 모든 작업에 정지 요청 후 기한 안에 워커 join (넘기면 false, 남은 작업은 stderr 에 기록)
+    auto shutdown(int deadlineMs = SHUTDOWN_DEADLINE_MS) -> bool {
+        bool joined = executor.joinFor(deadlineMs);
+        logPrint(LogLevel::Info, "[ Server ] 워커 스레드 종료 %s", joined ? "완료" : "기한 초과");
+        return joined;
     }
 };
 
 ServerApp* g_server = nullptr;
 
-int main() {
+// [ SRP : 단일 책임 원칙 ] -> 세마포어 모드의 턴 인계 (다음 플레이어에게 차례 신호)
+// [ OCP : 개방 폐쇄 원칙 ] -> 인계 방식(SysV 세마포어 / futex 초인종)을 바꿔도 메인 루프는 그대로
+// 초인종은 세그먼트 안에 있어 경합 없는 울리기는 원자 연산 하나, 세마포어는 매번 semop 시스템 콜
+class TurnHandoff {
+    SharedData* data;
+    SemHandoff mode;
+    int semId = -1;
+public:
+    TurnHandoff(SharedData* d, SemHandoff m) : data{d}, mode{m} {}
+
+    // 플레이어 N명 = 멤버 N개인 세마포어 집합 하나 (이전 실행의 집합이 남아 있으면 크기가 다를 수 있어 새로 생성)
+    // 재부착이면 클라이언트가 쓰던 집합을 그대로 사용 (멤버 수가 맞을 때만), 초인종 방식이면 남은 집합은 지움
+    auto open(int players, bool reattached) -> bool {
+        semId = semget(SEM_KEY, 0, 0666);
+        if (mode == HANDOFF_FUTEX) {
+            if (semId != -1) semctl(semId, 0, IPC_RMID);
+            semId = -1;
+        } else {
+            semid_ds semInfo{};
+            bool reuseSem = reattached && semId != -1 && semctl(semId, 0, IPC_STAT, &semInfo) == 0 && (int)semInfo.sem_nsems == players;
+            if (!reuseSem) {
+                if (semId != -1) semctl(semId, 0, IPC_RMID);
+                semId = semget(SEM_KEY, players, 0666 | IPC_CREAT);
+                if (semId == -1) { perror("semget"); return false; }
+                vector<unsigned short> zeros(players, 0);
+                semctl(semId, 0, SETALL, zeros.data());
+            }
+        }
+        shmStore(data->handoff, (uint32_t)mode); // 클라이언트는 이 값을 보고 대기 방식을 고름
+        turnSignalRaise(data->turn_signal);
+        return true;
+    }
+
+    // 차례 신호 (세마포어 V / 초인종 울리기), 시스템 콜 수를 메트릭에 기록
+    auto pass(int playerId, MetricsSlot& metrics) -> void {
+        if (mode == HANDOFF_FUTEX) {
+            if (doorbellRing(data->doorbell, playerId)) metrics.add(M_SYSCALLS);
+            return;
+        }
+        sembuf v{};
+        v.sem_num = (unsigned short)(playerId - 1);
+        v.sem_op = 1;
+        semop(semId, &v, 1);
+        metrics.add(M_SYSCALLS);
+    }
+
+    // 정리 : 세마포어는 삭제(대기 중인 P 는 EIDRM), 초인종은 닫기 (대기 중인 쪽은 Closed)
+    auto close() -> void {
+        if (mode == HANDOFF_FUTEX) doorbellClose(data->doorbell);
+        else if (semId != -1) semctl(semId, 0, IPC_RMID);
+        semId = -1;
+    }
+};
+
+// 턴 인계 방식 (--handoff sem|futex 또는 BR31_HANDOFF, 기본 futex), argv 에서 제거, 모르는 이름이면 false
+static auto handoffRequested(int& argc, char* argv[], SemHandoff& mode) -> bool {
+    const char* name = getenv("BR31_HANDOFF");
+    int out = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--handoff") == 0 && i + 1 < argc) name = argv[++i];
+        else argv[out++] = argv[i];
+    }
+    argc = out;
+    argv[argc] = nullptr;
+    mode = HANDOFF_FUTEX;
+    if (name == nullptr || strcmp(name, "futex") == 0) return true;
+    if (strcmp(name, "sem") == 0) mode = HANDOFF_SEM;
+    return mode == HANDOFF_SEM;
+}
+
+// SIGINT / SIGTERM -> 진행 중인 게임을 끝내고(--recover 면 상태 보존) 정리 후 종료
+volatile sig_atomic_t stop_requested = 0;
+
+// 턴 주인의 제안을 기다리는 기한 : 클라이언트의 생각 시간 (최대 개수만큼) + 턴 종료 텀 + 여유 1초
+inline auto proposalWaitUs() -> uint64_t {
+    return Pacing::get().thinkUs * MAX_PER_TURN + Pacing::get().turnEndUs + 1000000;
+}
+
+void handle_stop(int) { stop_requested = 1; }
+
+// 링 모드 : ServerApp 에 플레이어별 ShmRingReceiver 를 붙여 클라이언트 이동을 수신
+// recover : 링 세그먼트도 재부착해 처리하지 못한 이동을 이어서 소비
+// 종료 요청이면 워커를 기한 안에 join 한 뒤, --recover 가 아니면 게임을 끝내 클라이언트도 빠져나가게 함
+int runRingMode(SharedData* shared, int players, bool recover, const ExecutorOptions& opt) {
+    int ringShmId = -1;
+    RingSegment* rings = nullptr;
+    if (shmAttach(RING_SHM_KEY, RING_SHM_LAYOUT, recover, ringShmId, rings) == ShmAttach::Failed) return 1;
+
+    GameState state(shared);
+    GameLogic logic(state);
+    Broadcaster bc(state, g_spectators);
+    ServerApp app(state, logic, bc, opt);
+    g_server = &app;
+
+    // 링 클라이언트는 링 세그먼트의 view 만 읽음 (턴 순서 링 + 현재 상태를 먼저 기록한 뒤 수신 시작)
+    RingSink sink(logic, rings->view);
+    sink.publish(&shared->turn_ring);
+    publishSpectator(SPEC_START, state, players, 0);
+
+    deque<ShmRingReceiver> receivers;
+    for (int p = 1; p <= players; ++p) {
+        receivers.emplace_back(&rings->rings[p - 1], p, sink, g_metrics);
+        app.addReceiver(&receivers.back());
+    }
+    app.run();
+
+    while (!state.isGameOver() && !stop_requested) paceSleep(Pacing::get().pollUs);
+    if (stop_requested) {
+        logPrint(LogLevel::Info, "[ Server ] SIGINT/SIGTERM 수신 - 종료 처리 시작");
+        if (!recover) {
+            state.setGameOver("");
+            publishSpectator(SPEC_OVER, state, 0, 0);
+        }
+    }
+    app.shutdown();
+    sink.publish();
+
+    shmdt(rings);
+    if (!(stop_requested && recover)) shmctl(ringShmId, IPC_RMID, nullptr);
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    // 실행 인자 : [--pace normal|turbo|배율] [--instance N] [--cpus 목록|auto] [--recover] [--threads N] [--pin] [--handoff sem|futex] [ring] [플레이어 수 (기본 2)]
+    if (!configureCommon(argc, argv)) return 1;
+    ExecutorOptions execOpt;
+    if (!execOpt.configure(argc, argv)) {
+        cerr << "invalid --threads" << endl;
+        return 1;
+    }
+    bool recover = recoverRequested(argc, argv);
+    SemHandoff handoffMode;
+    if (!handoffRequested(argc, argv, handoffMode)) {
+        cerr << "invalid --handoff ( sem|futex )" << endl;
+        return 1;
+    }
+    bool ringMode = argc > 1 && strcmp(argv[1], "ring") == 0;
+    int argPlayers = ringMode ? 2 : 1;
+    int players = (argc > argPlayers) ? atoi(argv[argPlayers]) : 2;
+    if (players < 2 || players > MAX_PLAYERS) {
+        cerr << "usage: " << argv[0] << " [--handoff sem|futex] [ring] [players 2~" << MAX_PLAYERS << "]" << endl;
+        return 1;
+    }
+
     ios::sync_with_stdio(false);
     cin.tie(nullptr);
     cout.tie(nullptr);
     setvbuf(stdout, NULL, _IONBF, 0);
 
-    int shmId = shmget(SHM_KEY, sizeof(SharedData), 0666 | IPC_CREAT);
-    if (shmId == -1) { perror("shmget"); return 1; }
-    SharedData* shared = (SharedData*)shmat(shmId, nullptr, 0);
-    if (shared == (void*)-1) { perror("shmat"); return 1; }
-    memset(shared, 0, sizeof(SharedData));
-    shared->current_turn = 1;
-
-    int semId1 = semget(SEM_KEY_01, 1, 0666 | IPC_CREAT);
-    int semId2 = semget(SEM_KEY_02, 1, 0666 | IPC_CREAT);
-    semctl(semId1, 0, SETVAL, 0);
-    semctl(semId2, 0, SETVAL, 0);
-
-    cout << "============================\n";
-    cout << "[ Server ] BR31 Server Start!!\n";
-    cout << "============================\n";
-
-    sembuf sops{};
-    sops.sem_num = 0;
-    sops.sem_flg = 0;
-
-    int number = 0;
-    int turn = 1;
-
-    while (number < MAX_NUM) {
-        cout << "[ Semaphore ] ( 신호 감지 -> 턴 진행 P" << turn << " )" << endl;
-        cout.flush();
-
-        for (int i = 0; i < 2; i++) {
-            int temp = (turn == 1) ? 1 : 2;
-            number++;
-            shared->current_num = number;
-            cout << "[ Client P" << temp << " ] 외친 숫자 = " << number << endl;
-            cout.flush();
-            usleep(250000);
+    struct sigaction sa{};
+    sa.sa_handler = handle_stop;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, nullptr);
+    sigaction(SIGTERM, &sa, nullptr);
+
+    // --recover : 이전 서버의 세그먼트가 유효하면 초기화 없이 재부착 (플레이어 수는 세그먼트의 턴 순서 링을 따름)
+    int shmId = -1;
+    SharedData* shared = nullptr;
+    ShmAttach attach = shmAttach(SHM_KEY, SEM_SHM_LAYOUT, recover, shmId, shared);
+    if (attach == ShmAttach::Failed) return 1;
+    bool reattached = attach == ShmAttach::Reattached;
+    if (reattached) {
+        players = shared->turn_ring.players;
+        bool fixed = GameState(shared).repair();
+        logPrint(LogLevel::Info, "[ Recover ] 세대 %llu 재부착 ( number = %d, turn = P%d%s%s )",
+                 (unsigned long long)shared->header.generation, shared->current_num, shared->current_turn,
+                 fixed ? ", 반쯤 반영된 이동 복구" : "", shared->gameover ? ", 이미 종료된 게임" : "");
+    } else {
+        if (!GameState(shared).init()) return 1; // 재부착이면 이전 서버가 초기화한 잠금을 그대로 사용
+        turnRingInit(shared->turn_ring, players);
+        shared->current_turn = 1;
+    }
+    g_metrics.open(METRICS_KEY_SEM);
+    g_spectators.open(SPECTATOR_KEY_SEM);
+
+    // 실행 인자 "ring" -> 공유 메모리 링 전송 사용
+    if (ringMode) {
+        int rc = runRingMode(shared, players, recover, execOpt);
+        shmdt(shared);
+        if (stop_requested && recover) {
+            logPrint(LogLevel::Info, "[ Server ] 종료 요청 - 상태 보존 ( --recover 로 다시 시작하면 이어서 진행 )");
+        } else {
+            shmctl(shmId, IPC_RMID, nullptr);
+            logPrint(LogLevel::Info, "[ Server ] IPC 리소스 정리 완료");
+        }
+        g_metrics.remove();
+        g_spectators.remove();
+        logShutdown();
+        return rc;
+    }
+
+    // 턴 인계 준비 (세마포어 집합 생성 / 초인종 열기) 후 방식을 세그먼트에 기록
+    TurnHandoff handoff(shared, handoffMode);
+    if (!handoff.open(players, reattached)) return 1;
+
+    // 클라이언트가 하나 이상 공유 메모리에 붙을 때까지 대기 (지연 없는 turbo 모드에서 클라이언트 없이 게임이 끝나는 것 방지)
+    shmid_ds ds{};
+    while (!stop_requested && shmctl(shmId, IPC_STAT, &ds) == 0 && ds.shm_nattch < 2) paceSleep(Pacing::get().pollUs);
+
+    logPrint(LogLevel::Info, "============================");
+    logPrint(LogLevel::Info, "[ Server ] BR31 Server Start!! ( handoff = %s )", handoffMode == HANDOFF_FUTEX ? "futex" : "sem");
+    if (Instance::id() != 0) {
+        logPrint(LogLevel::Info, "[ Instance ] %d ( SHM 키 0x%x, %s, CPU %d 개 )", Instance::id(), (unsigned)SHM_KEY, PIPE_PATH, Instance::cpuCount());
+    }
+    logPrint(LogLevel::Info, "============================");
+
+    MetricsSlot& metrics = g_metrics.claim("main");
+
+    // 재부착이면 공유 메모리에 남은 숫자 / 턴에서 이어서 진행 (턴 주인의 V 가 유실됐을 수 있음)
+    // 첫 턴도 차례 신호를 보내야 턴 주인이 제안할 수 있음
+    // 상태 변경은 세그먼트 안의 잠금으로 (GameState), 클라이언트는 같은 잠금으로 이번 턴 개수를 제안
+    GameState state(shared);
+    int number = state.getNumber();
+    int turn = state.getTurn();
+    publishSpectator(SPEC_START, state, players, 0);
+    if (!state.isGameOver()) handoff.pass(turn, metrics);
+
+    int cnt = 0; // 마지막으로 반영한 이동 (종료 이벤트에 실음)
+    while (number < MAX_NUM && !state.isGameOver() && !stop_requested) {
+        // 턴 주인의 제안을 기한 안에서 기다리고, 없으면 (클라이언트 없음 / 응답 없음) 기존처럼 2개
+        int proposed = state.awaitProposal(turn, proposalWaitUs(), stop_requested);
+        cnt = proposed > 0 ? proposed : 2;
+        logPrint(LogLevel::Info, "[ Semaphore ] ( 신호 감지 -> 턴 진행 P%d%s )", turn, proposed > 0 ? ", 제안 반영" : "");
+        uint64_t started = metricsNowNs();
+        metrics.add(M_MOVES_APPLIED);
+        state.beginMove(turn, cnt);
+        int mover = turn;
+        int from = number;
+
+        for (int i = 0; i < cnt; i++) {
+            number = state.callNumber(cnt);
+            logPrint(LogLevel::Info, "[ Client P%d ] 외친 숫자 = %d", turn, number);
+            paceSleep(Pacing::get().numberUs);
             if (number >= MAX_NUM) break;
         }
+        state.recordMove(mover, from, number - from);
 
         if (number >= MAX_NUM) break;
 
-        cout << "[ Broadcast ] ( 턴 교체 -> 다음 턴 P" << (turn == 1 ? 2 : 1) << " )" << endl;
-        cout.flush();
+        // 턴 교대 : 링에서 다음 플레이어 조회 (O(1)) 후 그 플레이어에게만 차례 신호
+        state.switchTurn();
+        turn = state.getTurn();
+        logPrint(LogLevel::Info, "[ Broadcast ] ( 턴 교체 -> 다음 턴 P%d )", turn);
+        state.endMove();
+        publishSpectator(SPEC_MOVE, state, mover, cnt);
 
-        turn = (turn == 1 ? 2 : 1);
-        shared->current_turn = turn;
+        handoff.pass(turn, metrics);
+        metrics.record(H_APPLY_NS, metricsNowNs() - started);
 
-        int nextSem = (turn == 1) ? semId1 : semId2;
-        sops.sem_op = 1;
-        semop(nextSem, &sops, 1);
+        paceSleep(Pacing::get().turnUs);
+    }
 
-        usleep(300000); 
+    // --recover 로 실행 중 외부 종료 요청 -> 상태 보존 (세그먼트 / 세마포어 / 초인종 유지)
+    if (stop_requested && recover) {
+        logPrint(LogLevel::Info, "[ Server ] 종료 요청 - 상태 보존 ( --recover 로 다시 시작하면 이어서 진행 )");
+        shmdt(shared);
+        g_metrics.remove();
+        g_spectators.remove();
+        logShutdown();
+        return 0;
     }
 
-    cout << "[ Result ] GAME OVER ( 패배한 클라이언트 -> P" << (turn == 1 ? 1 : 2) << "!! )" << endl;
-    cout.flush();
+    // 종료 플래그를 남겨 공유 메모리를 폴링하는 클라이언트도 빠져나가게 함 (프로세스 그룹에 시그널을 보내지 않음)
+    if (stop_requested) {
+        logPrint(LogLevel::Info, "[ Server ] SIGINT/SIGTERM 수신 - 종료 처리 시작");
+        state.setGameOver("");
+        state.endMove();
+        publishSpectator(SPEC_OVER, state, 0, 0);
+    } else {
+        logPrint(LogLevel::Info, "[ Result ] GAME OVER ( 패배한 클라이언트 -> P%d!! )", turn);
+        state.setGameOver("P" + to_string(turn));
+        metrics.add(M_GAMES_FINISHED);
+        state.endMove();
+        publishSpectator(SPEC_MOVE, state, turn, cnt);
+        publishSpectator(SPEC_OVER, state, turn, cnt);
+    }
 
+    handoff.close();
     shmdt(shared);
     shmctl(shmId, IPC_RMID, nullptr);
-    semctl(semId1, 0, IPC_RMID);
-    semctl(semId2, 0, IPC_RMID);
-    cout << "[ Server ] IPC 리소스 정리 완료" << endl;
-    cout.flush();
-
-    kill(0, SIGINT);
+    g_metrics.remove();
+    g_spectators.remove();
+    logPrint(LogLevel::Info, "[ Server ] IPC 리소스 정리 완료");
+    logShutdown();
 
     return 0;
 }
\ No newline at end of file
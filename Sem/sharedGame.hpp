@@ -0,0 +1,126 @@
+#pragma once
+
+#include "headerSet.hpp"
+#include "../Common/pacing.hpp"
+
+// 세마포어 모드 공유 상태의 동기화 규칙 (sem_server 의 GameState 와 클라이언트가 함께 따름)
+// - 상태 변경은 세그먼트 안의 robust 뮤텍스(SharedData::lock) 안에서만
+// - 턴 / 숫자 / 종료는 잠금 안에서 shmStore 로 쓰고, 읽는 쪽은 잠금 없이 shmLoad 로 읽음 (읽기마다 서버 왕복 없음)
+// - 서버는 쓸 때마다 turn_signal 을 올림 -> 클라이언트는 폴링 대신 알림으로 잠들었다가 깨어나 다시 읽음
+// - 잠금을 쥔 채 프로세스가 죽으면 다음에 잠그는 쪽이 sharedRepair 로 상태를 맞춘 뒤 이어서 사용
+
+// 잠금 주인이 죽었을 때 상태 맞추기, 고쳤으면 true
+// 세그먼트의 서버가 살아 있으면 반영 중인 이동(MoveIntent)은 서버 몫 -> 잠금만 회수 (죽은 쪽은 클라이언트)
+// 서버가 죽었으면 반쯤 반영된 이동을 마저 적용, 제안은 한 번에 기록되는 워드 하나라 맞출 것이 없음
+inline auto sharedRepair(SharedData& d) -> bool {
+    int owner = d.header.owner_pid;
+    if (owner == getpid() || shmOwnerAlive(owner)) return false;
+    return moveIntentRepair(d, MAX_NUM);
+}
+
+static const timespec SHARED_WAIT{1, 0}; // 턴 알림 대기 한 번의 최대 길이 (서버가 죽어도 상태를 다시 확인)
+
+// 이동 워드 (제안 / 반영 기록 공통) : playerId << 16 | 이동 전 숫자 << 8 | cnt -> 같은 플레이어의 이동은 이동 전 숫자로 구분
+inline auto proposalPack(int playerId, int from, int cnt) -> uint32_t {
+    return (uint32_t)playerId << 16 | (uint32_t)(from & 0xff) << 8 | (uint32_t)(cnt & 0xff);
+}
+inline auto proposalPlayer(uint32_t p) -> int { return (int)(p >> 16); }
+inline auto proposalFrom(uint32_t p) -> int { return (int)((p >> 8) & 0xff); }
+inline auto proposalCnt(uint32_t p) -> int { return (int)(p & 0xff); }
+
+// 턴 인계 방식 : 서버가 다음 플레이어에게 차례 신호를 주는 방법 (--handoff)
+enum SemHandoff : uint32_t {
+    HANDOFF_NONE = 0,  // 서버 준비 전
+    HANDOFF_SEM = 1,   // SysV 세마포어 집합 (SEM_KEY, 멤버 playerId - 1) semop P / V
+    HANDOFF_FUTEX = 2  // 세그먼트 안의 초인종 (경합 없으면 원자 연산뿐, 잠든 쪽이 있을 때만 futex)
+};
+
+enum class Proposal {
+    Accepted,    // 이번 턴 이동으로 기록 (서버가 턴을 진행할 때 반영)
+    NotYourTurn, // 현재 턴이 아니거나 제안을 계산한 뒤 숫자가 바뀜 (서버가 이미 기본 개수로 진행 중)
+    GameOver,    // 이미 종료된 게임
+    Unavailable  // 잠금을 쓸 수 없음 (복구 불가 상태)
+};
+
+// [ SRP ] 클라이언트 측 공유 상태 접근 : 잠금 없는 읽기 + 원자적 이동 제안
+class SharedGame {
+    SharedData* data;
+public:
+    explicit SharedGame(SharedData* d) : data{d} {}
+
+    auto number() const -> int { return shmLoad(data->current_num); }
+    auto turn() const -> int { return shmLoad(data->current_turn); }
+    auto gameOver() const -> bool { return shmLoad(data->gameover); }
+
+    // 조건이 참이 될 때까지 서버의 턴 알림으로 잠듦 (종료 확인은 조건에 포함해서)
+    template <typename Done>
+    auto waitUntil(Done done) const -> void { turnSignalAwait(data->turn_signal, done, &SHARED_WAIT); }
+
+    // 이 플레이어의 마지막으로 반영된 이동이 from 에서 시작했으면 실제로 외친 개수, 아니면 0
+    // 서버는 이동을 마치고 턴을 넘기기 전에 기록 -> 0 이 아니면 그 이동은 끝남
+    auto appliedCnt(int playerId, int from) const -> int {
+        uint32_t m = shmLoad(data->last_move[playerId - 1]);
+        return proposalPlayer(m) == playerId && proposalFrom(m) == from ? proposalCnt(m) : 0;
+    }
+
+    // 턴 / 숫자 확인과 제안 기록을 한 번의 임계 구역에서 (from : 제안을 계산한 숫자, 그 사이 바뀌었으면 NotYourTurn)
+    // 기록 후 서버에 알림, 잠금 주인이 죽어 있었으면 ownerDied 가 true (상태는 이미 복구된 뒤)
+    auto propose(int playerId, int from, int cnt, bool* ownerDied = nullptr) -> Proposal {
+        ShmLock guard(data->lock, [this] { sharedRepair(*data); });
+        if (ownerDied != nullptr) *ownerDied = guard.ownerDied();
+        if (!guard.locked()) return Proposal::Unavailable;
+        if (data->gameover) return Proposal::GameOver;
+        if (data->current_turn != playerId || data->current_num != from) return Proposal::NotYourTurn;
+        shmStore(data->proposal, proposalPack(playerId, from, cnt));
+        turnSignalRaise(data->proposal_signal);
+        return Proposal::Accepted;
+    }
+};
+
+// [ SRP ] 클라이언트 측 차례 신호 받기 : 서버가 세그먼트에 기록한 인계 방식을 따름
+class TurnBell {
+    SharedData* data;
+    int playerId;
+    int semId = -1;
+public:
+    TurnBell(SharedData* d, int pid) : data{d}, playerId{pid} {}
+
+    auto mode() const -> uint32_t { return shmLoad(data->handoff); }
+
+    // 서버 초기화 완료까지 대기, 세마포어 방식이면 집합이 생길 때까지도 대기 (false -> 그 사이 게임 종료)
+    auto open() -> bool {
+        turnSignalAwait(data->turn_signal, [this] { return mode() != HANDOFF_NONE || shmLoad(data->gameover); }, &SHARED_WAIT);
+        while (mode() == HANDOFF_SEM && !shmLoad(data->gameover) && (semId = semget(SEM_KEY, 0, 0666)) == -1) {
+            perror("semget 대기 중");
+            sleep(1);
+        }
+        return !shmLoad(data->gameover);
+    }
+
+    // 내 차례 신호 (세마포어 P / 초인종 가져가기), false -> 서버가 정리함
+    auto take() -> bool {
+        if (mode() == HANDOFF_FUTEX) return doorbellTake(data->doorbell, playerId) == DoorbellTake::Taken;
+        sembuf p{};
+        p.sem_num = (unsigned short)(playerId - 1);
+        p.sem_op = -1;
+        while (semop(semId, &p, 1) == -1) {
+            if (errno == EINTR) continue;
+            if (errno != EIDRM && errno != EINVAL) perror("semop P");
+            return false;
+        }
+        return true;
+    }
+
+    // 숫자 하나를 외칠 때마다 : 세마포어 방식은 예전처럼 자기 멤버 V (서버는 기다리지 않음), 초인종 방식은 할 일 없음
+    auto called() -> bool {
+        if (mode() == HANDOFF_FUTEX) return true;
+        sembuf v{};
+        v.sem_num = (unsigned short)(playerId - 1);
+        v.sem_op = 1;
+        if (semop(semId, &v, 1) == -1) {
+            if (errno != EIDRM && errno != EINVAL) perror("semop V");
+            return false;
+        }
+        return true;
+    }
+};
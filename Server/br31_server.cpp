@@ -0,0 +1,218 @@
+#include "transport.hpp"
+#include "fifoTransport.hpp"
+#include "ringTransport.hpp"
+#include "socketTransport.hpp"
+#include "msgqTransport.hpp"
+#include "../Pipe/serverSetup.hpp"
+#include "../Common/asyncLogger.hpp"
+#include "../Common/pacing.hpp"
+#include "../Common/taskExecutor.hpp"
+#include "../Common/commonOptions.hpp"
+
+// 통합 서버 : 게임 엔진(GameTable / GameLogic) 하나에 여러 전송의 수신기를 동시에 연결
+// 게임 상태는 pipe_server 와 같은 SharedTable (SHM_KEY) -> pipe_client 는 수정 없이 접속, 링 클라이언트는 링 세그먼트의 view 를 읽음
+// pipe_server / sem_server ring 과 같은 IPC 키를 쓰므로 동시에 띄우지 않음
+
+// 등록된 전송 (--transport 이름,이름,...)
+static const TransportEntry TRANSPORTS[] = {
+    {"fifo", "FIFO 레코드 배치 ( pipe_client )", [] { return std::unique_ptr<ITransport>(new FifoTransport); }},
+    {"ring", "공유 메모리 SPSC 링 ( sem_ring_client, --ring-game 게임 하나 )", [] { return std::unique_ptr<ITransport>(new RingTransport); }},
+    {"socket", "Unix 도메인 SOCK_SEQPACKET + epoll ( sock_client, 연결 하나 = 플레이어 하나 )", [] { return std::unique_ptr<ITransport>(new SocketTransport); }},
+    {"msgq", "SysV 메시지 큐 ( msgq_client, 요청 / 응답 큐 둘을 모든 플레이어가 공유, mtype = 플레이어 주소 )", [] { return std::unique_ptr<ITransport>(new MsgQueueTransport); }},
+};
+
+static auto findTransport(const string& name) -> const TransportEntry* {
+    for (const TransportEntry& e : TRANSPORTS) {
+        if (name == e.name) return &e;
+    }
+    return nullptr;
+}
+
+static void printUsage(const char* prog) {
+    cerr << "usage: " << prog << " [--transport fifo,ring,socket,msgq] [--ring-game G] [--io epoll|uring] [--pace normal|turbo|<scale>] [--instance N] [--cpus list|auto]"
+         << " [--journal dir [--durable]] [--recover] [--threads N] [--pin] [--turn-timeout sec] [--on-timeout forfeit|move] [games 1~" << MAX_GAMES << "] [players 2~" << MAX_PLAYERS << "]" << endl;
+    for (const TransportEntry& e : TRANSPORTS) cerr << "    " << e.name << " : " << e.summary << endl;
+}
+
+// SIGINT / SIGTERM -> 진행 중인 게임을 끝내고(--recover 면 상태 보존) 정리 후 종료
+// SA_RESTART 없이 등록 -> 메인 스레드의 futex 대기가 EINTR 로 바로 돌아옴
+volatile sig_atomic_t stop_requested = 0;
+
+void handle_stop(int) { stop_requested = 1; }
+
+static constexpr uint64_t RECEIVER_SLICE_NS = 1000000; // 워커가 수신기보다 적을 때 수신기 한 번의 최대 대기 (1ms)
+static constexpr int SHUTDOWN_DEADLINE_MS = 2000;
+
+int main(int argc, char* argv[]) {
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+    cout.tie(nullptr);
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    // 실행 인자 : [--transport fifo,ring,socket,msgq] [--ring-game G] [--io epoll|uring] [--pace ...] [--instance N] [--cpus 목록|auto] [--journal 디렉터리 [--durable]] [--recover] [--threads N] [--pin]
+    //            [--turn-timeout 초] [--on-timeout forfeit|move] 게임 수 (기본 1) 게임당 플레이어 수 (기본 2)
+    if (!configureCommon(argc, argv)) return 1;
+    JournalOptions journalOpt;
+    journalOpt.configure(argc, argv);
+    ExecutorOptions execOpt;
+    if (!execOpt.configure(argc, argv)) {
+        cerr << "invalid --threads" << endl;
+        return 1;
+    }
+    bool recover = recoverRequested(argc, argv);
+    DeadlineOptions deadlineOpt;
+    if (!deadlineOpt.configure(argc, argv)) {
+        cerr << "invalid turn deadline ( --turn-timeout <seconds> --on-timeout forfeit|move )" << endl;
+        return 1;
+    }
+
+    string transportList = "fifo";
+    if (const char* env = getenv("BR31_TRANSPORT")) transportList = env;
+    string ioName = "epoll";
+    if (const char* env = getenv("BR31_IO")) ioName = env;
+    int ringGame = 0;
+    vector<char*> positional;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--transport") == 0 && i + 1 < argc) transportList = argv[++i];
+        else if (strcmp(argv[i], "--ring-game") == 0 && i + 1 < argc) ringGame = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--io") == 0 && i + 1 < argc) ioName = argv[++i];
+        else positional.push_back(argv[i]);
+    }
+    int gameCount = positional.size() > 0 ? atoi(positional[0]) : 1;
+    int playerCount = positional.size() > 1 ? atoi(positional[1]) : 2;
+    if (ioName != "epoll" && ioName != "uring") {
+        cerr << "unknown io backend : " << ioName << endl;
+        printUsage(argv[0]);
+        return 1;
+    }
+    if (positional.size() > 2 || gameCount < 1 || gameCount > MAX_GAMES || playerCount < 2 || playerCount > MAX_PLAYERS) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // 전송 목록 검증 (중복은 한 번만)
+    vector<const TransportEntry*> selected;
+    size_t pos = 0;
+    while (pos <= transportList.size()) {
+        size_t comma = transportList.find(',', pos);
+        if (comma == string::npos) comma = transportList.size();
+        string name = transportList.substr(pos, comma - pos);
+        pos = comma + 1;
+        if (name.empty()) continue;
+        const TransportEntry* e = findTransport(name);
+        if (e == nullptr) {
+            cerr << "unknown transport : " << name << endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+        if (find(selected.begin(), selected.end(), e) == selected.end()) selected.push_back(e);
+    }
+    if (selected.empty()) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    struct sigaction sa{};
+    sa.sa_handler = handle_stop;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, nullptr);
+    sigaction(SIGTERM, &sa, nullptr);
+
+    // IPC 초기화 (--recover : 이전 서버의 세그먼트가 유효하면 초기화 없이 재부착, pipe_server 와 같은 GameSegment)
+    GameSegment segment;
+    if (!segment.attach(recover, gameCount, playerCount)) return 1;
+    SharedTable* shared = segment.shared;
+    bool reattached = segment.reattached;
+    gameCount = segment.games;
+    playerCount = segment.players;
+
+    // 이동 저널 (--journal 지정 시, 게임 시작 레코드부터 기록)
+    MoveJournal journal;
+    if (journalOpt.dir != nullptr && !journal.open(journalOpt, reattached)) return 1;
+
+    // 수신기가 여러 스레드에서 apply 를 호출 -> concurrent
+    GameTable games(shared, gameCount, playerCount, journal, !reattached, true);
+
+    // 턴 기한 : 메인 스레드가 게임 종료 futex 대기의 timeout 을 가장 이른 기한에 맞춰 만료 처리 (수신기 스레드는 기한만 걸고 풂)
+    TurnDeadlines deadlines;
+    if (!deadlines.open(gameCount, deadlineOpt.timeoutNs(), false)) return 1;
+    games.attachDeadlines(deadlines, deadlineOpt.policy, reattached);
+
+    // 메트릭 (br31_stat -t server 로 조회), 수신기마다 슬롯 하나
+    ServerMetrics metrics;
+    metrics.open(METRICS_KEY_SERVER);
+
+    // 관전 채널 (br31_watch -t server 로 조회), 모든 전송의 이동이 같은 채널로
+    SpectatorChannel spectators;
+    spectators.open(SPECTATOR_KEY_SERVER);
+    games.attachSpectators(spectators);
+
+    // io_uring 을 요청해도 커널이 멀티샷 read / 제공 버퍼 링을 지원하지 않거나 막혀 있으면 (seccomp, io_uring_disabled) epoll 로
+    IoBackend io = IoBackend::Epoll;
+    if (ioName == "uring") {
+        if (uringSupported()) io = IoBackend::Uring;
+        else logPrint(LogLevel::Warn, "[ Server ] io_uring 사용 불가 -> epoll 로 대체");
+    }
+
+    ServerContext ctx{games, shared, reattached, journal.isOpen() && journalOpt.durable, ringGame, metrics, io};
+    vector<unique_ptr<ITransport>> transports;
+    vector<IReceiver*> receivers;
+    bool opened = true;
+    for (const TransportEntry* e : selected) {
+        transports.push_back(e->make());
+        if (!transports.back()->open(ctx)) {
+            logPrint(LogLevel::Error, "[ Transport ] %s 준비 실패", e->name);
+            opened = false;
+            break;
+        }
+        for (IReceiver* r : transports.back()->receivers()) receivers.push_back(r);
+    }
+
+    string detail = ", transport = " + transportList + ", io = " + (io == IoBackend::Uring ? "uring" : "epoll");
+    segment.logStart(detail.c_str(), games, journal, journalOpt, deadlines, deadlineOpt);
+
+    // 수신기를 executor 작업으로 등록 (워커가 수신기보다 적으면 수신기는 RECEIVER_SLICE_NS 까지만 대기하고 양보)
+    TaskExecutor executor(execOpt);
+    if (opened) {
+        int tasks = (int)receivers.size();
+        int threads = executor.start(tasks);
+        uint64_t waitNs = threads < tasks ? RECEIVER_SLICE_NS : 0;
+        logPrint(LogLevel::Info, "[ Server ] 수신기 %d 개 / 워커 스레드 %d 개%s", tasks, threads,
+                 waitNs > 0 ? " ( 수신기 1ms 단위 양보 )" : "");
+        for (size_t i = 0; i < receivers.size(); ++i) {
+            IReceiver* r = receivers[i];
+            executor.submit("receiver " + to_string(i), [r, waitNs](const StopToken& stop) { return r->poll(stop, waitNs); },
+                            [r] { r->wake(); });
+        }
+
+        // 모든 게임이 끝나거나 종료 요청이 올 때까지 대기 (마지막 게임이 끝나면 futex 로 바로 깨어남)
+        // 대기는 가장 이른 턴 기한까지로 줄여서, 깨어날 때마다 지난 기한을 처리
+        timespec period{0, 100000000}; // 100ms
+        if (deadlines.enabled()) metrics.claim("deadline"); // 기한 초과로 끝내거나 대신 둔 이동은 이 슬롯에 기록
+        while (!stop_requested) {
+            timespec wait = deadlines.untilNext(period);
+            if (games.waitFinished(&wait)) break;
+            deadlines.expire([&games](int id) { games.expireTurn(id); });
+        }
+    }
+
+    if (stop_requested) {
+        logPrint(LogLevel::Info, "[ Server ] SIGINT/SIGTERM 수신 - 종료 처리 시작");
+        if (!recover) games.finishAll(); // 진행 중인 게임에 게임오버 플래그 -> 클라이언트도 빠져나감
+    }
+    bool joined = executor.joinFor(SHUTDOWN_DEADLINE_MS);
+    if (opened) logPrint(LogLevel::Info, "[ Server ] 워커 스레드 종료 %s", joined ? "완료" : "기한 초과");
+
+    // --recover 로 실행 중 외부 종료 요청 -> 상태 보존 (세그먼트 / FIFO / 링 유지, 클라이언트는 재시작을 기다림)
+    bool preserve = stop_requested && recover;
+    for (auto& t : transports) t->close(preserve);
+    if (journal.isOpen() && !preserve) logPrint(LogLevel::Info, "[ Journal ] 레코드 %u 개 기록", journal.lastSeq());
+    journal.close();
+    segment.release(preserve);
+    if (preserve) logPrint(LogLevel::Info, "[ Server ] 종료 요청 - 상태 보존 ( --recover 로 다시 시작하면 이어서 진행 )");
+    else logPrint(LogLevel::Info, "[ Server ] IPC 리소스 정리 완료");
+    metrics.remove();
+    spectators.remove();
+    logShutdown();
+    return opened ? 0 : 1;
+}
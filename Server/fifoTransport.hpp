@@ -0,0 +1,233 @@
+#pragma once // br31_server FIFO 전송 : pipe_server 와 같은 FIFO / 레코드 프로토콜 (pipe_client 그대로 접속)
+
+#include "transport.hpp"
+#include "../Pipe/fifoDispatch.hpp"
+#include "../Common/uring.hpp"
+
+// [ OCP ] FIFO 기반 입력 수신 채널 - epoll 백엔드 (수신기 하나가 모든 게임의 레코드를 배치로 처리)
+// wake 는 자기 self-pipe 에 1 바이트 -> epoll 대기 중단
+class FifoReceiver : public IReceiver {
+    GameTable& games;
+    PipeReceiver receiver;
+    EventWaiter waiter;
+    FifoDispatcher dispatcher;
+    int wakeFd;
+    ServerMetrics& metricsOwner;
+    MetricsSlot* metrics = nullptr;
+    MoveRecord batch[MOVE_BATCH];
+public:
+    FifoReceiver(ServerContext& ctx, int fifoFd, int wakeRead, int wakeWrite)
+        : games{ctx.games}, receiver{fifoFd}, waiter{fifoFd, wakeRead},
+          dispatcher{ctx.games, &ctx.shared->session_hwm, ctx.reattached, ctx.deferReplies}, wakeFd{wakeWrite},
+          metricsOwner{ctx.metrics} {}
+
+    auto valid() -> bool { return waiter.valid(); }
+
+    auto poll(const StopToken& stop, uint64_t waitNs) -> TaskStep override {
+        if (metrics == nullptr) metrics = &metricsOwner.claim("fifo");
+        threadMetrics() = metrics;
+        while (!stop.stopRequested() && games.unfinished() > 0) {
+            int n = receiver.readBatch(batch, MOVE_BATCH);
+            if (n == 0) {
+                int timeoutMs = waitNs > 0 ? (int)((waitNs + 999999) / 1000000) : -1;
+                uint64_t waitStart = metricsNowNs();
+                bool readable = waiter.wait(timeoutMs);
+                metrics->add(M_WAKEUPS);
+                metrics->record(H_WAIT_NS, metricsNowNs() - waitStart);
+                if (!readable && waitNs > 0) return TaskStep::Yield; // 제한 시간 경과 -> 워커 양보
+                continue; // 읽기 가능 or wake (루프 조건에서 정지 확인)
+            }
+            metrics->add(M_RECORDS_READ, (uint64_t)n);
+            metrics->record(H_BATCH, (uint64_t)n);
+            dispatcher.dispatch(batch, n);
+            if (waitNs > 0) return TaskStep::Yield;
+        }
+        return TaskStep::Done;
+    }
+
+    void wake() override {
+        char c = 1;
+        (void)!write(wakeFd, &c, 1);
+    }
+};
+
+// [ OCP ] FIFO 기반 입력 수신 채널 - io_uring 백엔드
+// FIFO 에 멀티샷 read 를 한 번 걸어 두면 데이터가 올 때마다 커널이 제공 버퍼를 채워 완료를 쌓음 -> 준비 통지 뒤 read 가 따로 없음
+// io_uring_enter 한 번에 쌓인 완료를 모두 모아 배치로 처리 (응답은 세션별 응답 FIFO write 그대로)
+class UringFifoReceiver : public IReceiver {
+    enum : uint8_t { K_READ = 1, K_WAKE = 2 };
+
+    GameTable& games;
+    FifoDispatcher dispatcher;
+    int fifoFd;
+    int wakeRead;
+    int wakeFd;
+    ServerMetrics& metricsOwner;
+    MetricsSlot* metrics = nullptr;
+    UringBufRing bufs; // ring 보다 먼저 선언 -> ring 을 먼저 닫은 뒤 버퍼 해제
+    UringQueue ring;
+    bool ready = false;
+    bool readArmed = false;
+    bool wakeArmed = false;
+    uint64_t entersSeen = 0;
+
+    MoveRecord batch[MOVE_BATCH];
+    int batched = 0;
+    char partial[sizeof(MoveRecord)]; // 버퍼 경계에 걸친 레코드 앞부분 (PIPE_BUF 이하 write 는 원자적이므로 보통 비어 있음)
+    size_t partialLen = 0;
+
+    auto flushBatch(uint64_t& records) -> void {
+        if (batched == 0) return;
+        records += (uint64_t)batched;
+        dispatcher.dispatch(batch, batched);
+        batched = 0;
+    }
+
+    // 읽은 바이트를 레코드 단위로 잘라 배치에 추가 (가득 차면 그 자리에서 처리)
+    // 해석할 수 없는 레코드면 PipeReceiver 와 같이 이번 버퍼의 나머지를 버려 다음 완료부터 경계를 새로 맞춤
+    auto consume(const char* p, size_t len, uint64_t& records) -> void {
+        while (len > 0) {
+            if (partialLen > 0 || len < sizeof(MoveRecord)) {
+                size_t take = std::min(len, sizeof(MoveRecord) - partialLen);
+                memcpy(partial + partialLen, p, take);
+                partialLen += take;
+                p += take;
+                len -= take;
+                if (partialLen < sizeof(MoveRecord)) return;
+                memcpy(&batch[batched++], partial, sizeof(MoveRecord));
+                partialLen = 0;
+            } else {
+                memcpy(&batch[batched++], p, sizeof(MoveRecord));
+                p += sizeof(MoveRecord);
+                len -= sizeof(MoveRecord);
+            }
+            const MoveRecord& last = batch[batched - 1];
+            if (!moveRecordValid(last)) {
+                logPrint(LogLevel::Warn, "[ Pipe ] 해석할 수 없는 레코드 ( v%u type %u ) -> 남은 %zu 바이트 버림", (unsigned)last.version,
+                         (unsigned)last.type, len);
+                --batched;
+                return;
+            }
+            if (batched == MOVE_BATCH) flushBatch(records);
+        }
+    }
+
+    auto countSyscalls() -> void {
+        metrics->add(M_SYSCALLS, ring.enterCount() - entersSeen);
+        entersSeen = ring.enterCount();
+    }
+public:
+    UringFifoReceiver(ServerContext& ctx, int fifo, int wakeR, int wakeW)
+        : games{ctx.games}, dispatcher{ctx.games, &ctx.shared->session_hwm, ctx.reattached, ctx.deferReplies}, fifoFd{fifo},
+          wakeRead{wakeR}, wakeFd{wakeW}, metricsOwner{ctx.metrics} {
+        ready = ring.open(64, 256) && bufs.open(ring, 0, 16, MOVE_BATCH * sizeof(MoveRecord));
+    }
+
+    auto valid() -> bool { return ready; }
+
+    auto poll(const StopToken& stop, uint64_t waitNs) -> TaskStep override {
+        if (metrics == nullptr) metrics = &metricsOwner.claim("fifo uring");
+        threadMetrics() = metrics;
+        while (!stop.stopRequested() && games.unfinished() > 0) {
+            if (!readArmed) {
+                uringPrepReadMulti(ring.sqe(), fifoFd, bufs, uringTag(K_READ, 0));
+                readArmed = true;
+            }
+            if (!wakeArmed) {
+                uringPrepPollMulti(ring.sqe(), wakeRead, uringTag(K_WAKE, 0));
+                wakeArmed = true;
+            }
+            uint64_t waitStart = metricsNowNs();
+            int r = ring.submit(1, waitNs);
+            metrics->add(M_WAKEUPS);
+            metrics->record(H_WAIT_NS, metricsNowNs() - waitStart);
+            countSyscalls();
+            if (r < 0 && r != -ETIME && r != -EINTR) {
+                errno = -r;
+                perror("io_uring_enter ( fifo )");
+                return TaskStep::Done;
+            }
+
+            uint64_t records = 0;
+            int readError = 0;
+            ring.drain([&](const io_uring_cqe& cqe) {
+                if (uringTagKind(cqe.user_data) == K_WAKE) {
+                    char drainBuf[64];
+                    while (read(wakeRead, drainBuf, sizeof(drainBuf)) > 0) {}
+                    if (!(cqe.flags & IORING_CQE_F_MORE)) wakeArmed = false;
+                    return;
+                }
+                if (cqe.flags & IORING_CQE_F_BUFFER) {
+                    uint16_t bid = (uint16_t)(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+                    if (cqe.res > 0) consume(bufs.buffer(bid), (size_t)cqe.res, records);
+                    bufs.put(bid);
+                }
+                if (!(cqe.flags & IORING_CQE_F_MORE)) {
+                    readArmed = false; // 버퍼 부족(-ENOBUFS) -> 버퍼를 돌려준 뒤 다시 걸기
+                    if (cqe.res < 0 && cqe.res != -ENOBUFS) readError = -cqe.res; // 그 밖의 오류는 다시 걸어도 같은 실패 -> 수신기 종료
+                }
+            });
+            bufs.publish();
+            flushBatch(records);
+            if (readError != 0) {
+                errno = readError;
+                perror("multishot read ( fifo )");
+                return TaskStep::Done;
+            }
+            if (records > 0) {
+                metrics->add(M_RECORDS_READ, records);
+                metrics->record(H_BATCH, records);
+            }
+            if (waitNs > 0) return TaskStep::Yield;
+        }
+        return TaskStep::Done;
+    }
+
+    void wake() override {
+        char c = 1;
+        (void)!write(wakeFd, &c, 1);
+    }
+};
+
+// [ SRP ] FIFO / 깨우기 pipe 수명 관리, ctx.io 에 따라 수신기 백엔드 선택
+class FifoTransport : public ITransport {
+    int pipeFd = -1;
+    int keepAliveFd = -1;
+    int wakePipe[2] = {-1, -1};
+    std::unique_ptr<IReceiver> receiver;
+public:
+    auto open(ServerContext& ctx) -> bool override {
+        if (mkfifo(PIPE_PATH, 0666) == -1 && errno != EEXIST) { perror("mkfifo"); }
+        pipeFd = ::open(PIPE_PATH, O_RDONLY | O_NONBLOCK);
+        if (pipeFd == -1) { perror("open fifo"); return false; }
+        // 서버가 쓰기 끝을 하나 잡아 두어 클라이언트가 모두 close 해도 EOF(EPOLLHUP)가 반복되지 않게 함
+        keepAliveFd = ::open(PIPE_PATH, O_WRONLY | O_NONBLOCK);
+        if (keepAliveFd == -1) { perror("open fifo ( keep-alive )"); return false; }
+        if (pipe2(wakePipe, O_NONBLOCK | O_CLOEXEC) == -1) { perror("pipe2"); return false; }
+
+        bool uring = ctx.io == IoBackend::Uring;
+        if (uring) {
+            UringFifoReceiver* r = new UringFifoReceiver(ctx, pipeFd, wakePipe[0], wakePipe[1]);
+            receiver.reset(r);
+            if (!r->valid()) { logPrint(LogLevel::Error, "[ Transport ] fifo : io_uring 준비 실패"); return false; }
+        } else {
+            FifoReceiver* r = new FifoReceiver(ctx, pipeFd, wakePipe[0], wakePipe[1]);
+            receiver.reset(r);
+            if (!r->valid()) return false;
+        }
+        logPrint(LogLevel::Info, "[ Transport ] fifo : %s ( %s )", PIPE_PATH, uring ? "io_uring" : "epoll");
+        return true;
+    }
+
+    auto receivers() -> std::vector<IReceiver*> override { return {receiver.get()}; }
+
+    // preserve 면 FIFO 경로를 남겨 재시작한 서버에 클라이언트가 다시 붙게 함
+    auto close(bool preserve) -> void override {
+        receiver.reset();
+        for (int fd : {keepAliveFd, pipeFd, wakePipe[0], wakePipe[1]}) {
+            if (fd != -1) ::close(fd);
+        }
+        keepAliveFd = pipeFd = wakePipe[0] = wakePipe[1] = -1;
+        if (!preserve) unlink(PIPE_PATH);
+    }
+};
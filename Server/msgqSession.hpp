@@ -0,0 +1,100 @@
+#pragma once
+
+#include "../Pipe/headerSet.hpp"
+#include "../Common/pacing.hpp"
+#include <sys/msg.h>
+
+// [ SRP ] 메시지 큐 전송 클라이언트 세션 (br31_server --transport msgq)
+// 모든 클라이언트가 요청 큐 / 응답 큐를 함께 쓰고, 자기 주소 mtype (게임 / 플레이어) 으로 보내고 같은 mtype 의 응답만 꺼냄
+// 레코드 형식은 FIFO / 소켓과 같음 (연결 상태가 없어 게임 / 플레이어는 mtype 이 대신함)
+// 서버가 종료하며 큐를 지우면 전송 / 수신이 false (EIDRM), --recover 종료면 큐가 남아 재시작한 서버의 응답을 그대로 기다림
+class MsgqSession {
+    int requestQ = -1;
+    int replyQ = -1;
+    uint32_t seq = 0;
+    uint32_t gameId = 0;
+    int playerId = 0;
+
+    auto replyType() const -> long { return msgqPlayerType(gameId, playerId); }
+
+    auto send(MoveRecord rec) -> bool {
+        MsgRequest msg{replyType(), rec};
+        msg.rec.version = MOVE_PROTO_VERSION;
+        msg.rec.seq = ++seq;
+        msg.rec.game_id = gameId;
+        msg.rec.player_id = (uint16_t)playerId;
+        msg.rec.pid = getpid();
+        return msgsnd(requestQ, &msg, sizeof(MoveRecord), 0) == 0;
+    }
+
+    // 같은 주소로 남아 있는 응답 버리기 (이전에 같은 게임 / 플레이어로 접속했던 클라이언트 몫)
+    auto purge() -> void {
+        MsgReply stale;
+        while (msgrcv(replyQ, &stale, sizeof(ReplyRecord), replyType(), IPC_NOWAIT | MSG_NOERROR) >= 0) {}
+    }
+public:
+    // 서버가 두 큐를 만들 때까지 재시도 (stop 이 nullptr 이면 한 번만 시도)
+    auto open(volatile sig_atomic_t* stop = nullptr) -> bool {
+        while (true) {
+            requestQ = msgget(MSG_KEY, 0);
+            replyQ = msgget(MSG_REPLY_KEY, 0);
+            if (requestQ != -1 && replyQ != -1) return true;
+            if (stop == nullptr || *stop) return false;
+            paceSleep(Pacing::get().pollUs);
+        }
+    }
+
+    // CONNECT 전송만 (응답은 awaitReply 로 따로 수신 -> 세션 여러 개를 한꺼번에 묶을 때)
+    auto submitConnect(int game, int player) -> bool {
+        gameId = (uint32_t)game;
+        playerId = player;
+        purge();
+        MoveRecord rec{};
+        rec.type = REC_CONNECT;
+        return send(rec);
+    }
+
+    // 큐 연결 후 게임 / 플레이어 등록, 수락되면 true (reply 에 현재 숫자 / 턴)
+    auto connect(int game, int player, volatile sig_atomic_t& stop, ReplyRecord& reply) -> bool {
+        if (!open(&stop)) return false;
+        return submitConnect(game, player) && awaitReply(reply) && reply.status == REPLY_OK;
+    }
+
+    // 이동 전송만 (응답은 awaitReply 로 따로 수신)
+    auto submitMove(int cnt) -> bool {
+        MoveRecord rec{};
+        rec.type = REC_MOVE;
+        rec.cnt = (uint16_t)cnt;
+        return send(rec);
+    }
+
+    // 방금 보낸 레코드의 응답 대기 (큐 삭제 / 시그널이면 false), seq 가 다른 응답은 버림
+    auto awaitReply(ReplyRecord& reply) -> bool {
+        MsgReply msg;
+        while (true) {
+            ssize_t n = msgrcv(replyQ, &msg, sizeof(ReplyRecord), replyType(), MSG_NOERROR);
+            if (n != (ssize_t)sizeof(ReplyRecord) || msg.rec.version != MOVE_PROTO_VERSION) return false;
+            if (msg.rec.seq == seq) {
+                reply = msg.rec;
+                return true;
+            }
+        }
+    }
+
+    auto sendMove(int cnt, ReplyRecord& reply) -> bool { return submitMove(cnt) && awaitReply(reply); }
+
+    // 큐에는 연결이 없으므로 DISCONNECT 없이 늦게 도착한 자기 응답만 치움
+    auto disconnect() -> void {
+        if (replyQ == -1) return;
+        if (playerId != 0) purge();
+        requestQ = replyQ = -1;
+    }
+
+    MsgqSession() = default;
+    MsgqSession(const MsgqSession&) = delete;
+    MsgqSession(MsgqSession&& o) noexcept
+        : requestQ{o.requestQ}, replyQ{o.replyQ}, seq{o.seq}, gameId{o.gameId}, playerId{o.playerId} {
+        o.requestQ = o.replyQ = -1;
+    }
+    ~MsgqSession() { disconnect(); }
+};
@@ -0,0 +1,210 @@
+#pragma once // br31_server SysV 메시지 큐 전송 : 요청 큐 하나 + 응답 큐 하나를 모든 플레이어가 공유, mtype = 플레이어 주소
+
+#include "transport.hpp"
+#include <sys/msg.h>
+
+#define MSGQ_BATCH 256        // 한 번 깨어난 뒤 IPC_NOWAIT 로 이어서 꺼내는 최대 요청 수 (FIFO 의 MOVE_BATCH 와 같은 역할)
+#define MSGQ_BYTES (4 << 20)  // 요청하는 큐 용량 msg_qbytes (권한이 없으면 커널 기본값 msgmnb 그대로)
+#define MSGQ_RETRY_US 50      // 응답 큐가 가득 차 응답이 남았을 때 다시 보내기 전 쉬는 시간
+#define MSGQ_DRAIN_MS 1000    // 종료 시 남은 응답 전송 / 클라이언트가 응답 큐를 비우기를 기다리는 최대 시간 (각각)
+
+// [ OCP ] 메시지 큐 기반 입력 수신 채널
+// 요청 큐는 msgrcv(mtype 0 : 도착 순서대로), 응답은 요청의 mtype 그대로 응답 큐에 -> 클라이언트는 자기 mtype 만 꺼냄
+// 큐 두 개를 모든 플레이어가 나눠 쓰므로 플레이어 수와 무관하게 fd / 응답 FIFO 없음 (게임 / 플레이어는 mtype 에서 계산)
+// 첫 요청은 블로킹 msgrcv 로 기다리고, 깨어나면 큐가 빌 때까지(ENOMSG) IPC_NOWAIT 로 모아 처리 -> 저널 그룹 커밋 -> 응답 msgsnd(IPC_NOWAIT)
+// 응답 큐가 가득 차면 남은 응답을 들고 요청은 계속 비움 : 요청 / 응답이 한 큐의 용량을 나눠 쓰면
+// 응답을 읽기 전에 요청을 여러 개 보내는 클라이언트(벤치)가 가득 찬 큐에서 서로를 기다리게 되므로 큐를 나눔
+// 메시지 큐는 fd 가 아니라 timeout 대기가 없음 : 워커를 나눠 쓰면 (waitNs > 0) 비어 있을 때 waitNs 만큼 잠든 뒤 양보
+class MsgQueueReceiver : public IReceiver {
+    GameTable& games;
+    int requestQ;
+    int replyQ;
+    ServerMetrics& metricsOwner;
+    MetricsSlot* metrics = nullptr;
+    MsgRequest inbox{};
+    vector<MsgReply> replies; // 보낼 응답 (sent 앞쪽은 전송 완료, 한 플레이어의 응답 순서 유지)
+    size_t sent = 0;
+
+    auto queueReply(long to, const MoveRecord& rec, int16_t status, int number, int turn) -> void {
+        replies.push_back(MsgReply{to, ReplyRecord{MOVE_PROTO_VERSION, status, 0, rec.seq, number, turn}});
+    }
+
+    // 요청 하나 처리 (게임 / 플레이어는 mtype 에서 계산 -> 응답도 같은 mtype 으로)
+    auto handle(long from, const MoveRecord& rec) -> void {
+        if (rec.version != MOVE_PROTO_VERSION) {
+            logPrint(LogLevel::Warn, "[  MsgQueue ] 지원하지 않는 프로토콜 버전 v%u", (unsigned)rec.version);
+            return;
+        }
+        if (rec.type == REC_DISCONNECT) return; // 큐에는 연결 상태가 없음
+        int gameId = (int)((from - MSGQ_WAKE_TYPE - 1) / MAX_PLAYERS);
+        int playerId = (int)((from - MSGQ_WAKE_TYPE - 1) % MAX_PLAYERS) + 1;
+        GameLogic* logic = games.logic(gameId);
+        if (logic == nullptr || playerId > logic->getState().getPlayers()) {
+            queueReply(from, rec, REPLY_REJECTED, 0, 0);
+            return;
+        }
+        GameState& state = logic->getState();
+        if (rec.type == REC_CONNECT) {
+            games.joined(gameId);
+            queueReply(from, rec, REPLY_OK, state.getNumber(), state.getTurn());
+            logPrint(LogLevel::Info, "[  Session  ] 연결 M%ld ( G%d P%d )", from, gameId, playerId);
+            return;
+        }
+        if (rec.type != REC_MOVE) return;
+        if (state.isGameOver()) {
+            queueReply(from, rec, REPLY_GAME_OVER, state.getNumber(), state.getTurn());
+            return;
+        }
+        char tag[32] = "";
+        if (games.size() > 1) snprintf(tag, sizeof(tag), "[ Game %d ] ", gameId);
+        logPrint(LogLevel::Info, "%s[  MsgQueue ] ( 신호 감지 -> 턴 진행 P%d #%u )", tag, playerId, rec.seq);
+        MoveResult r = games.apply(gameId, playerId, rec.cnt);
+        int16_t status = replyStatusOf(r);
+        queueReply(from, rec, status, state.getNumber(), state.getTurn());
+    }
+
+    // 요청 하나 꺼내기 : 1 = 요청 / 0 = 없음 (IPC_NOWAIT 의 ENOMSG, 깨우기 메시지, 형식이 다른 메시지) / -1 = 큐 삭제 또는 오류
+    // MSG_NOERROR : 크기가 다른 메시지는 잘라서 꺼낸 뒤 버림
+    auto receive(bool wait) -> int {
+        while (true) {
+            ssize_t n = msgrcv(requestQ, &inbox, sizeof(MoveRecord), 0, MSG_NOERROR | (wait ? 0 : IPC_NOWAIT));
+            metrics->add(M_SYSCALLS);
+            if (n == (ssize_t)sizeof(MoveRecord) && inbox.mtype > MSGQ_WAKE_TYPE) return 1;
+            if (n >= 0) return 0;
+            if (errno == EINTR) {
+                if (wait) return 0; // 정지 확인은 호출하는 쪽 루프에서
+                continue;
+            }
+            if (errno == ENOMSG) return 0;
+            if (errno != EIDRM) perror("msgrcv ( msgq )");
+            return -1;
+        }
+    }
+
+    // 남은 응답을 순서대로 전송, 응답 큐가 가득 차면 (EAGAIN) 멈추고 다음 처리 때 이어서
+    auto flushReplies() -> void {
+        while (sent < replies.size()) {
+            int rc = msgsnd(replyQ, &replies[sent], sizeof(ReplyRecord), IPC_NOWAIT);
+            metrics->add(M_SYSCALLS);
+            if (rc == -1) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN) return;
+                break; // 큐 삭제 -> 받을 쪽도 없음
+            }
+            ++sent;
+        }
+        replies.clear();
+        sent = 0;
+    }
+public:
+    MsgQueueReceiver(ServerContext& ctx, int reqQ, int repQ) : games{ctx.games}, requestQ{reqQ}, replyQ{repQ}, metricsOwner{ctx.metrics} {}
+
+    auto poll(const StopToken& stop, uint64_t waitNs) -> TaskStep override {
+        if (metrics == nullptr) metrics = &metricsOwner.claim("msgq");
+        threadMetrics() = metrics;
+        while (!stop.stopRequested() && games.unfinished() > 0) {
+            // 보내지 못한 응답이 남았거나 워커를 나눠 쓰면 블로킹하지 않음
+            bool backlog = !replies.empty();
+            bool block = waitNs == 0 && !backlog;
+            uint64_t waitStart = metricsNowNs();
+            int r = receive(block);
+            if (block) {
+                metrics->add(M_WAKEUPS);
+                metrics->record(H_WAIT_NS, metricsNowNs() - waitStart);
+            }
+            uint64_t records = 0;
+            while (r > 0) {
+                handle(inbox.mtype, inbox.rec);
+                if (++records >= MSGQ_BATCH) break;
+                r = receive(false);
+            }
+            if (r < 0) return TaskStep::Done;
+            if (records > 0) {
+                metrics->add(M_RECORDS_READ, records);
+                metrics->record(H_BATCH, records);
+            }
+
+            // 그룹 커밋 뒤 응답 전송
+            games.commitJournal();
+            flushReplies();
+            if (records == 0 && !block) {
+                if (waitNs > 0) {
+                    timespec idle = waitTimeout(waitNs);
+                    nanosleep(&idle, nullptr);
+                    return TaskStep::Yield;
+                }
+                if (backlog) usleep(MSGQ_RETRY_US);
+            }
+            if (waitNs > 0) return TaskStep::Yield;
+        }
+
+        // 마지막 처리의 응답 (게임 종료 응답 포함) : 응답 큐에 자리가 날 때까지 이어서 전송
+        // 마지막 게임이 끝나면 곧바로 정지 요청이 오므로 정지 토큰 대신 시간으로 제한
+        uint64_t deadline = metricsNowNs() + MSGQ_DRAIN_MS * 1000000ULL;
+        while (!replies.empty() && metricsNowNs() < deadline) {
+            flushReplies();
+            if (!replies.empty()) usleep(MSGQ_RETRY_US);
+        }
+        return TaskStep::Done;
+    }
+
+    // 크기 0 인 깨우기 메시지로 블로킹 msgrcv 를 깨움 (큐가 가득 차 실패해도 그때는 꺼낼 요청이 있어 대기 중이 아님)
+    void wake() override {
+        long marker = MSGQ_WAKE_TYPE;
+        (void)!msgsnd(requestQ, &marker, 0, IPC_NOWAIT);
+    }
+};
+
+// [ SRP ] 요청 / 응답 큐 수명 관리 (재부착이 아니면 이전 실행이 남긴 요청 / 응답과 함께 새로 만듦)
+class MsgQueueTransport : public ITransport {
+    int requestQ = -1;
+    int replyQ = -1;
+    std::unique_ptr<MsgQueueReceiver> receiver;
+
+    // 큐 하나 준비, 가능하면 용량을 MSGQ_BYTES 까지 늘림 (msgmnb 를 넘기려면 CAP_SYS_RESOURCE, 실패하면 기본 용량) -> 용량 반환
+    static auto create(key_t key, bool reattached, int& qid) -> unsigned long {
+        if (!reattached) {
+            int stale = msgget(key, 0);
+            if (stale != -1) msgctl(stale, IPC_RMID, nullptr);
+        }
+        qid = msgget(key, IPC_CREAT | 0666);
+        if (qid == -1) {
+            perror("msgget");
+            return 0;
+        }
+        msqid_ds ds{};
+        if (msgctl(qid, IPC_STAT, &ds) == 0 && ds.msg_qbytes < MSGQ_BYTES) {
+            ds.msg_qbytes = MSGQ_BYTES;
+            msgctl(qid, IPC_SET, &ds);
+            msgctl(qid, IPC_STAT, &ds);
+        }
+        return (unsigned long)ds.msg_qbytes;
+    }
+public:
+    auto open(ServerContext& ctx) -> bool override {
+        unsigned long requestBytes = create(MSG_KEY, ctx.reattached, requestQ);
+        if (requestQ == -1) return false;
+        unsigned long replyBytes = create(MSG_REPLY_KEY, ctx.reattached, replyQ);
+        if (replyQ == -1) return false;
+        receiver.reset(new MsgQueueReceiver(ctx, requestQ, replyQ));
+        logPrint(LogLevel::Info, "[ Transport ] msgq : 요청 key %d / 응답 key %d ( 용량 %lu / %lu 바이트, mtype = 플레이어 주소 )", MSG_KEY,
+                 MSG_REPLY_KEY, requestBytes, replyBytes);
+        return true;
+    }
+
+    auto receivers() -> std::vector<IReceiver*> override { return {receiver.get()}; }
+
+    // preserve : 큐를 남겨 클라이언트가 응답을 기다리는 채로 재시작한 서버가 남은 요청부터 이어서 처리
+    // 아니면 클라이언트가 남은 응답을 꺼낼 때까지 (최대 MSGQ_DRAIN_MS) 기다린 뒤 삭제 (삭제하면 꺼내지 않은 메시지도 사라짐)
+    auto close(bool preserve) -> void override {
+        receiver.reset();
+        if (!preserve && replyQ != -1) {
+            msqid_ds ds{};
+            for (int waited = 0; waited < MSGQ_DRAIN_MS && msgctl(replyQ, IPC_STAT, &ds) == 0 && ds.msg_qnum > 0; ++waited) usleep(1000);
+        }
+        for (int q : {requestQ, replyQ}) {
+            if (q != -1 && !preserve) msgctl(q, IPC_RMID, nullptr);
+        }
+        requestQ = replyQ = -1;
+    }
+};
@@ -0,0 +1,27 @@
+#include "msgqSession.hpp"
+#include "sessionBench.hpp"
+#include "../Common/commonOptions.hpp"
+
+// [ SRP ] 메시지 큐 전송 벤치마크 드라이버
+// br31_server --transport msgq 를 띄우고 게임 수 x 플레이어 수 만큼 세션을 스레드 하나에서 구동 (세션마다 fd 가 없어 fd 한도와 무관)
+// 라운드 진행 / 측정은 sessionBench.hpp (sock_bench 와 공용), 응답은 응답 큐에서 플레이어 주소 mtype 으로 모아 받음
+// FIFO(pipe_bench) / 세마포어(sem_bench) 결과와 같은 CSV / JSON 에 누적 -> make bench 로 함께 비교
+
+int main(int argc, char* argv[]) {
+    // --instance / --cpus 는 벤치가 띄우는 서버에도 (환경 변수로) 그대로 적용
+    if (!configureCommon(argc, argv, OPT_INSTANCE)) return 1;
+    BenchOptions opt;
+    if (!opt.parse(argc, argv) || opt.games > MAX_GAMES || opt.players > MAX_PLAYERS || opt.mode != nullptr) {
+        cerr << "usage: " << argv[0] << " [-g games] [-p players] [--csv file] [--json file]" << endl;
+        return 1;
+    }
+
+    // 이전 실행이 남긴 큐에 붙지 않도록 먼저 지우고, 서버가 새로 만든 큐를 기다림
+    for (key_t key : {MSG_KEY, MSG_REPLY_KEY}) {
+        int stale = msgget(key, 0);
+        if (stale != -1) msgctl(stale, IPC_RMID, nullptr);
+    }
+    string games = to_string(opt.games), players = to_string(opt.players);
+    char* serverArgv[] = {(char*)"./br31_server", (char*)"--transport", (char*)"msgq", (char*)games.c_str(), (char*)players.c_str(), nullptr};
+    return runSessionBench<MsgqSession>(opt, serverArgv, [] { return msgget(MSG_KEY, 0) != -1 && msgget(MSG_REPLY_KEY, 0) != -1; }, "msgq");
+}
@@ -0,0 +1,9 @@
+#include "msgqSession.hpp"
+#include "sessionClient.hpp"
+
+// br31_server --transport msgq 용 클라이언트 (플레이어 하나) : 이동 / 응답은 요청 큐 / 응답 큐에서 자기 주소 mtype 으로 주고받음
+// 턴 대기 / 이동 루프는 sessionClient.hpp (sock_client 와 공용)
+
+int main(int argc, char* argv[]) {
+    return runSessionClient<MsgqSession>(argc, argv, "메시지 큐 연결");
+}
@@ -0,0 +1,66 @@
+#pragma once // br31_server 공유 메모리 링 전송 : sem_server ring 과 같은 링 세그먼트 (sem_ring_client 그대로 접속)
+
+#include "transport.hpp"
+#include "../Common/ringReceiver.hpp"
+#include <deque>
+
+// [ SRP ] 링 수신기 -> 게임 엔진의 게임 하나
+class EngineSink : public IMoveSink {
+    GameTable& games;
+    int gameId;
+public:
+    EngineSink(GameTable& g, int id) : games{g}, gameId{id} {}
+    auto gameOver() -> bool override { return games.logic(gameId)->getState().isGameOver(); }
+    void submit(int playerId, int cnt) override { games.apply(gameId, playerId, cnt); }
+};
+
+// [ SRP ] 링 세그먼트 수명 관리 + 링 클라이언트용 view 갱신
+// 링 세그먼트 하나 = 게임 하나 (--ring-game), 다른 전송이 같은 게임에 둔 이동도 관찰자로 view 에 반영
+class RingTransport : public ITransport {
+    int shmId = -1;
+    RingSegment* seg = nullptr;
+    std::unique_ptr<EngineSink> sink;
+    std::deque<ShmRingReceiver> rings;
+public:
+    auto open(ServerContext& ctx) -> bool override {
+        int gameId = ctx.ringGame;
+        GameLogic* logic = ctx.games.logic(gameId);
+        if (logic == nullptr) {
+            logPrint(LogLevel::Error, "[ Transport ] ring : 게임 G%d 없음 ( 게임 수 %d )", gameId, ctx.games.size());
+            return false;
+        }
+        // 게임 세그먼트에 재부착했으면 링 세그먼트도 재부착 (처리하지 못한 이동을 이어서 소비)
+        if (shmAttach(RING_SHM_KEY, RING_SHM_LAYOUT, ctx.reattached, shmId, seg) == ShmAttach::Failed) {
+            seg = nullptr;
+            return false;
+        }
+
+        // 턴 순서 링 + 현재 상태를 먼저 기록 (turn 공개가 클라이언트 시작 신호)
+        GameState& state = logic->getState();
+        RingView* view = &seg->view;
+        view->turn_ring = ctx.shared->games[gameId].turn_ring;
+        ringViewPublish(*view, state.getNumber(), state.getTurn(), state.isGameOver());
+        ctx.games.addObserver([view, gameId](int id, GameState& s, int, int) {
+            if (id == gameId) ringViewPublish(*view, s.getNumber(), s.getTurn(), s.isGameOver());
+        });
+
+        sink.reset(new EngineSink(ctx.games, gameId));
+        for (int p = 1; p <= state.getPlayers(); ++p) rings.emplace_back(&seg->rings[p - 1], p, *sink, ctx.metrics);
+        logPrint(LogLevel::Info, "[ Transport ] ring : key %d -> G%d ( P1 ~ P%d )", RING_SHM_KEY, gameId, state.getPlayers());
+        return true;
+    }
+
+    auto receivers() -> std::vector<IReceiver*> override {
+        std::vector<IReceiver*> out;
+        for (auto& r : rings) out.push_back(&r);
+        return out;
+    }
+
+    auto close(bool preserve) -> void override {
+        rings.clear();
+        if (seg == nullptr) return;
+        shmdt(seg);
+        seg = nullptr;
+        if (!preserve) shmctl(shmId, IPC_RMID, nullptr);
+    }
+};
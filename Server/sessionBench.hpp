@@ -0,0 +1,103 @@
+#pragma once // 세션 전송 벤치마크 본체 : sock_bench / msgq_bench 공통 (서버 실행 인자 / 준비 확인 / 세션 타입만 다름)
+
+#include "../Pipe/headerSet.hpp"
+#include "../Common/benchStats.hpp"
+#include "../Common/serverMetrics.hpp"
+#include <sys/wait.h>
+
+// 게임 수 x 플레이어 수 만큼 세션을 스레드 하나에서 구동, 모든 게임을 라운드 단위로 함께 진행
+// 라운드마다 게임별 현재 턴 세션으로 이동을 보낸 뒤 응답을 모아 받음 (턴은 응답의 숫자 / 턴으로 판단 -> turn_handoff 는 측정 안 함)
+// 제출 -> 응답 도착까지의 지연과 초당 이동 수, 서버 메트릭 세그먼트의 시스템 콜 카운터로 이동당 시스템 콜 수를 보고
+
+struct SessionBenchGame {
+    int number = 0;
+    int turn = 1;
+    bool over = false;
+    uint64_t sentNs = 0;
+};
+
+// 서버 메트릭 세그먼트의 시스템 콜 카운터 합계 (서버가 종료하며 삭제를 예약해도 붙어 있는 동안은 읽힘)
+inline auto serverSyscalls(const MetricsBlock* block) -> uint64_t {
+    if (block == nullptr) return 0;
+    uint64_t sum = 0;
+    uint32_t used = block->slots_used.load(memory_order_acquire);
+    for (uint32_t i = 0; i < used && i < METRICS_MAX_THREADS; ++i) sum += block->slots[i].counters[M_SYSCALLS].load(memory_order_relaxed);
+    return sum;
+}
+
+// serverArgv : 띄울 br31_server 실행 인자, ready : 서버가 세션을 받을 준비가 되면 true
+// Session 은 open / submitConnect / submitMove / awaitReply 를 같은 모양으로 제공 (SockSession / MsgqSession)
+template <typename Session, typename Ready>
+inline auto runSessionBench(const BenchOptions& opt, char* const serverArgv[], Ready ready, const string& transport) -> int {
+    size_t sessionCount = (size_t)opt.games * opt.players;
+    pid_t server = spawnBenchServer(serverArgv);
+    if (server == -1) { perror("fork"); return 1; }
+    while (!ready()) usleep(10000);
+    int metricsId = shmget(METRICS_KEY_SERVER, 0, 0);
+    const MetricsBlock* metrics = metricsId == -1 ? nullptr : (const MetricsBlock*)shmat(metricsId, nullptr, SHM_RDONLY);
+    if (metrics == (void*)-1) metrics = nullptr;
+
+    // CONNECT 를 모두 보낸 뒤 응답을 모아 받음
+    volatile sig_atomic_t stop = 0;
+    vector<Session> sessions(sessionCount);
+    vector<SessionBenchGame> state(opt.games);
+    uint64_t connectStart = benchNowNs();
+    for (size_t i = 0; i < sessionCount; ++i) {
+        if (!sessions[i].open(&stop)) { cerr << "[ Bench ] 세션 열기 실패 #" << i << endl; return 1; }
+        if (!sessions[i].submitConnect((int)(i / opt.players), (int)(i % opt.players) + 1)) { cerr << "[ Bench ] CONNECT 전송 실패" << endl; return 1; }
+    }
+    for (size_t i = 0; i < sessionCount; ++i) {
+        ReplyRecord reply{};
+        if (!sessions[i].awaitReply(reply) || reply.status != REPLY_OK) { cerr << "[ Bench ] 연결 거절 #" << i << endl; return 1; }
+        SessionBenchGame& g = state[i / opt.players];
+        g.number = reply.number;
+        g.turn = reply.turn;
+    }
+    printf("[ Bench ] 세션 %zu 개 연결 %.1fms\n", sessionCount, (benchNowNs() - connectStart) / 1e6);
+
+    BenchResult result;
+    result.transport = transport;
+    result.games = opt.games;
+    result.players = opt.players;
+
+    uint64_t start = benchNowNs();
+    uint64_t syscallsStart = serverSyscalls(metrics);
+    int live = opt.games;
+    while (live > 0) {
+        for (int g = 0; g < opt.games; ++g) {
+            SessionBenchGame& s = state[g];
+            if (s.over) continue;
+            s.sentNs = benchNowNs();
+            if (!sessions[(size_t)g * opt.players + s.turn - 1].submitMove(min(2, MAX_NUM - s.number))) {
+                s.over = true;
+                --live;
+            }
+        }
+        for (int g = 0; g < opt.games; ++g) {
+            SessionBenchGame& s = state[g];
+            if (s.over) continue;
+            ReplyRecord reply{};
+            if (!sessions[(size_t)g * opt.players + s.turn - 1].awaitReply(reply)) {
+                s.over = true;
+                --live;
+                continue;
+            }
+            result.submit.record(benchNowNs() - s.sentNs);
+            result.moves++;
+            s.number = reply.number;
+            s.turn = reply.turn;
+            if (reply.status == REPLY_GAME_OVER || reply.number >= MAX_NUM) {
+                s.over = true;
+                --live;
+            }
+        }
+    }
+    result.seconds = (benchNowNs() - start) / 1e9;
+
+    sessions.clear();
+    waitpid(server, nullptr, 0);
+    result.syscalls = serverSyscalls(metrics) - syscallsStart;
+    if (metrics != nullptr) shmdt(metrics);
+    opt.report(result);
+    return 0;
+}
@@ -0,0 +1,74 @@
+#pragma once // 세션 전송 클라이언트 본체 : sock_client / msgq_client 공통 (세션 타입만 다름)
+
+#include "../Pipe/headerSet.hpp"
+#include "../Common/pacing.hpp"
+#include "../Common/strategyTable.hpp"
+#include "../Common/shmMutex.hpp"
+#include "../Common/commonOptions.hpp"
+#include <signal.h>
+
+// 턴은 pipe_client 처럼 공유 메모리의 게임 슬롯을 보고, 이동 / 응답은 세션(SockSession / MsgqSession)으로 주고받음
+// 세션 타입은 open / connect / sendMove / disconnect 를 같은 모양으로 제공
+
+inline volatile sig_atomic_t stop_requested = 0;
+
+inline void handle_sigint(int) {
+    stop_requested = 1;
+}
+
+static const timespec TURN_WAIT{1, 0}; // 턴 알림 대기 한 번의 최대 길이
+
+// linkName : 연결 실패 메시지에 쓰는 전송 이름 ("소켓 연결", "메시지 큐 연결")
+template <typename Session>
+inline auto runSessionClient(int argc, char* argv[], const char* linkName) -> int {
+    using Bot = StrategyTable<MAX_NUM, MAX_PER_TURN>; // 현재 숫자 -> 외칠 개수 (컴파일 시간 표 조회)
+
+    struct sigaction sa{};
+    sa.sa_handler = handle_sigint;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = 0;
+    sigaction(SIGINT, &sa, nullptr);
+    sigaction(SIGTERM, &sa, nullptr);
+
+    // 실행 인자 : [--pace normal|turbo|배율] 참가할 게임 id (기본 0) 플레이어 번호 (기본 1)
+    if (!configureCommon(argc, argv)) return 1;
+    int gameId = (argc > 1) ? atoi(argv[1]) : 0;
+    int playerId = (argc > 2) ? atoi(argv[2]) : 1;
+    if (gameId < 0 || gameId >= MAX_GAMES) { cerr << "invalid game id" << endl; return 1; }
+    if (playerId < 1 || playerId > MAX_PLAYERS) { cerr << "invalid player id" << endl; return 1; }
+
+    // CONNECT 가 수락되면 서버가 게임 세그먼트를 이미 만든 상태
+    Session session;
+    ReplyRecord reply{};
+    if (!session.connect(gameId, playerId, stop_requested, reply)) {
+        if (!stop_requested) cerr << "[ Client P" << playerId << " ] " << linkName << " 실패" << endl;
+        return 1;
+    }
+    int shmId = shmget(SHM_KEY, sizeof(SharedTable), 0666);
+    if (shmId == -1) { perror("shmget ( client )"); return 1; }
+    SharedTable* table = (SharedTable*)shmat(shmId, nullptr, 0);
+    if (table == (void*)-1) { perror("shmat ( client )"); return 1; }
+    SharedData* shared = &table->games[gameId];
+
+    while (!shmLoad(shared->gameover) && !stop_requested) {
+        // 턴 알림(futex)으로 자기 차례까지 잠듦 (알림 번호를 먼저 읽고 턴 확인 -> 그 사이 바뀌었으면 바로 진행)
+        while (!shmLoad(shared->gameover) && !stop_requested) {
+            uint32_t seen = shared->turn_signal.seq.load(memory_order_acquire);
+            if (shmLoad(shared->current_turn) == playerId || shmLoad(shared->gameover)) break;
+            turnSignalWait(shared->turn_signal, seen, &TURN_WAIT);
+        }
+        if (shmLoad(shared->gameover) || stop_requested) break;
+
+        // 전략 표에서 현재 숫자에 맞는 개수를 골라 외침
+        int cnt = Bot::bestMove(shmLoad(shared->current_num));
+        paceSleep(Pacing::get().thinkUs * cnt);
+
+        // 응답이 오면 턴 교대까지 끝난 상태
+        if (!session.sendMove(cnt, reply) || reply.status == REPLY_GAME_OVER) break;
+        paceSleep(Pacing::get().turnEndUs);
+    }
+
+    session.disconnect();
+    shmdt(table);
+    return 0;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "../Pipe/headerSet.hpp"
+#include "../Common/pacing.hpp"
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// [ SRP ] 소켓 전송 클라이언트 세션 (br31_server --transport socket)
+// 연결 하나 = 게임 / 플레이어 하나, 응답도 같은 연결로 도착 (응답 FIFO / 세션 id 없음)
+// 레코드 형식은 FIFO 와 같고 SOCK_SEQPACKET 이라 write / read 한 번이 레코드 하나
+// 서버가 종료하면 연결이 끊겨 전송 / 수신이 false (재시작을 따라가려면 다시 connect)
+class SockSession {
+    int fd = -1;
+    uint32_t seq = 0;
+
+    auto send(MoveRecord rec) -> bool {
+        rec.version = MOVE_PROTO_VERSION;
+        rec.seq = ++seq;
+        return ::send(fd, &rec, sizeof(rec), MSG_NOSIGNAL) == (ssize_t)sizeof(rec);
+    }
+public:
+    auto socketFd() -> int { return fd; }
+
+    // 서버 소켓이 생길 때까지 재시도하며 연결만 (stop 이 nullptr 이면 한 번만 시도)
+    auto open(volatile sig_atomic_t* stop = nullptr) -> bool {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", SOCK_PATH);
+        while (true) {
+            fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+            if (fd == -1) { perror("socket ( client )"); return false; }
+            if (::connect(fd, (sockaddr*)&addr, sizeof(addr)) == 0) return true;
+            ::close(fd);
+            fd = -1;
+            if (stop == nullptr || *stop) return false;
+            paceSleep(Pacing::get().pollUs);
+        }
+    }
+
+    // CONNECT 전송만 (응답은 awaitReply 로 따로 수신 -> 연결 여러 개를 한꺼번에 묶을 때)
+    auto submitConnect(int game, int player) -> bool {
+        MoveRecord rec{};
+        rec.type = REC_CONNECT;
+        rec.game_id = (uint32_t)game;
+        rec.player_id = (uint16_t)player;
+        return send(rec);
+    }
+
+    // 서버 연결 후 게임 / 플레이어를 연결에 묶음, 수락되면 true (reply 에 현재 숫자 / 턴)
+    auto connect(int game, int player, volatile sig_atomic_t& stop, ReplyRecord& reply) -> bool {
+        if (!open(&stop)) return false;
+        return submitConnect(game, player) && awaitReply(reply) && reply.status == REPLY_OK;
+    }
+
+    // 이동 전송만 (응답은 awaitReply 로 따로 수신)
+    auto submitMove(int cnt) -> bool {
+        MoveRecord rec{};
+        rec.type = REC_MOVE;
+        rec.cnt = (uint16_t)cnt;
+        return send(rec);
+    }
+
+    // 방금 보낸 레코드의 응답 대기 (연결 종료 / 시그널이면 false), seq 가 다른 응답은 버림
+    auto awaitReply(ReplyRecord& reply) -> bool {
+        while (true) {
+            ssize_t n = recv(fd, &reply, sizeof(reply), 0);
+            if (n != (ssize_t)sizeof(reply) || reply.version != MOVE_PROTO_VERSION) return false;
+            if (reply.seq == seq) return true;
+        }
+    }
+
+    auto sendMove(int cnt, ReplyRecord& reply) -> bool { return submitMove(cnt) && awaitReply(reply); }
+
+    auto disconnect() -> void {
+        if (fd == -1) return;
+        MoveRecord rec{};
+        rec.type = REC_DISCONNECT;
+        send(rec);
+        ::close(fd);
+        fd = -1;
+    }
+
+    SockSession() = default;
+    SockSession(const SockSession&) = delete;
+    SockSession(SockSession&& o) noexcept : fd{o.fd}, seq{o.seq} { o.fd = -1; }
+    ~SockSession() { disconnect(); }
+};
@@ -0,0 +1,44 @@
+#include "sockSession.hpp"
+#include "sessionBench.hpp"
+#include "../Common/commonOptions.hpp"
+#include <sys/resource.h>
+
+// [ SRP ] 소켓 전송 벤치마크 드라이버
+// br31_server --transport socket 을 띄우고 게임 수 x 플레이어 수 만큼 연결을 스레드 하나에서 열어 (-g 5000 -p 2 -> 연결 1만 개)
+// 라운드 진행 / 측정은 sessionBench.hpp (msgq_bench 와 공용), 응답은 이동을 보낸 연결로 도착
+// -m epoll|uring : 서버 수신기 I/O 백엔드
+
+// 연결마다 fd 하나 -> soft 한도를 hard 한도까지 올림
+static auto raiseFdLimit() -> rlim_t {
+    rlimit rl{};
+    if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < rl.rlim_max) {
+        rl.rlim_cur = rl.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &rl);
+    }
+    getrlimit(RLIMIT_NOFILE, &rl);
+    return rl.rlim_cur;
+}
+
+int main(int argc, char* argv[]) {
+    // --instance / --cpus 는 벤치가 띄우는 서버에도 (환경 변수로) 그대로 적용
+    if (!configureCommon(argc, argv, OPT_INSTANCE)) return 1;
+    BenchOptions opt;
+    const char* io = "epoll";
+    if (!opt.parse(argc, argv) || opt.games > MAX_GAMES || opt.players > MAX_PLAYERS ||
+        (opt.mode != nullptr && strcmp(opt.mode, "epoll") != 0 && strcmp(opt.mode, "uring") != 0)) {
+        cerr << "usage: " << argv[0] << " [-m epoll|uring] [-g games] [-p players] [--csv file] [--json file]" << endl;
+        return 1;
+    }
+    if (opt.mode != nullptr) io = opt.mode;
+    size_t connCount = (size_t)opt.games * opt.players;
+    rlim_t fdLimit = raiseFdLimit();
+    if (connCount + 16 > fdLimit) {
+        cerr << "[ Bench ] 연결 " << connCount << " 개가 fd 한도 " << fdLimit << " 를 넘음 ( ulimit -n )" << endl;
+        return 1;
+    }
+
+    string games = to_string(opt.games), players = to_string(opt.players);
+    char* serverArgv[] = {(char*)"./br31_server", (char*)"--transport", (char*)"socket", (char*)"--io", (char*)io,
+                          (char*)games.c_str(), (char*)players.c_str(), nullptr};
+    return runSessionBench<SockSession>(opt, serverArgv, [] { return access(SOCK_PATH, F_OK) == 0; }, string("socket-") + io);
+}
@@ -0,0 +1,9 @@
+#include "sockSession.hpp"
+#include "sessionClient.hpp"
+
+// br31_server --transport socket 용 클라이언트 (플레이어 하나) : 이동 / 응답은 소켓 연결 하나로 주고받음
+// 턴 대기 / 이동 루프는 sessionClient.hpp (msgq_client 와 공용)
+
+int main(int argc, char* argv[]) {
+    return runSessionClient<SockSession>(argc, argv, "소켓 연결");
+}
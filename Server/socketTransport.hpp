@@ -0,0 +1,538 @@
+#pragma once // br31_server Unix 도메인 소켓 전송 : SOCK_SEQPACKET (메시지 경계 유지) + edge-triggered epoll 또는 io_uring, 응답은 같은 연결로
+
+#include "transport.hpp"
+#include "../Common/uring.hpp"
+#include <deque>
+#include <unordered_map>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#define SOCK_BATCH 64         // recvmmsg / sendmmsg 한 번에 주고받는 최대 메시지 수
+#define SOCK_EVENTS 1024      // epoll_wait 한 번에 꺼내는 최대 이벤트 수
+#define SOCK_BACKLOG 4096     // listen 대기열 (커널 somaxconn 으로 잘림)
+#define SOCK_URING_SQ 4096    // io_uring 제출 큐 (가득 차면 중간에 한 번 더 제출)
+#define SOCK_URING_CQ 65536   // io_uring 완료 큐 (연결마다 수신 + 응답 완료가 한 번에 몰려도 넘치지 않게)
+#define SOCK_URING_BUFS 16384 // 제공 버퍼 수 (버퍼 하나 = 레코드 하나, 모자라면 해당 연결만 수신을 다시 걸어 둠)
+
+// [ SRP ] 연결 테이블 + 레코드 해석 (epoll / io_uring 수신기 공통)
+// 연결 자체가 클라이언트 식별 -> 세션 id / 응답 FIFO 없이 CONNECT 로 묶은 게임 / 플레이어를 연결에 기록
+// 자리 하나에 연결 하나 (FIFO 의 SessionTable 과 같은 규칙) : 묶인 연결의 재 CONNECT, 살아 있는 연결이 차지한 자리는 거절
+// 응답은 replies 에, 닫을 연결은 closeList 에 모아 두고 I/O 백엔드가 한 번의 처리 끝에 전송 / 종료
+class SocketConnTable {
+public:
+    struct Conn {
+        bool open = false;
+        bool closing = false; // 이번 처리 뒤 닫음 (보류 중인 응답이 재사용된 fd 로 가지 않게 close 를 미룸)
+        int gameId = -1;      // CONNECT 전에는 -1
+        int playerId = 0;
+        uint32_t gen = 0;     // fd 재사용 구분 (io_uring 완료의 user_data 와 비교)
+    };
+    struct PendingReply {
+        int fd;
+        ReplyRecord rec;
+    };
+
+    vector<PendingReply> replies; // 연결 하나의 응답은 연속으로 쌓임 (한 번의 처리에서 연결 하나의 레코드를 이어서 읽음)
+    vector<int> closeList;
+private:
+    GameTable& games;
+    vector<Conn> conns; // fd 로 인덱싱 (fd 번호는 작은 수부터 재사용되므로 연결 수만큼만 자람)
+    unordered_map<uint32_t, int> owners; // 게임 / 플레이어 자리 -> fd (release 에서 비움)
+    int live = 0;
+
+    auto queueReply(int fd, int16_t status, uint32_t seq, int number, int turn) -> void {
+        replies.push_back(PendingReply{fd, ReplyRecord{MOVE_PROTO_VERSION, status, (uint32_t)fd, seq, number, turn}});
+    }
+public:
+    explicit SocketConnTable(GameTable& g) : games{g} {}
+
+    auto connections() const -> int { return live; }
+
+    auto add(int fd) -> Conn& {
+        if ((size_t)fd >= conns.size()) conns.resize((size_t)fd * 2 + 1);
+        Conn& c = conns[fd];
+        c = Conn{true, false, -1, 0, (c.gen + 1) & 0xffffff};
+        ++live;
+        return c;
+    }
+
+    // 열려 있고 닫는 중이 아닌 연결 (gen 을 주면 세대까지 확인)
+    auto active(int fd, int64_t gen = -1) -> Conn* {
+        if (fd < 0 || (size_t)fd >= conns.size()) return nullptr;
+        Conn& c = conns[fd];
+        if (!c.open || c.closing || (gen >= 0 && c.gen != (uint32_t)gen)) return nullptr;
+        return &c;
+    }
+
+    auto markClosing(int fd) -> void {
+        if (!conns[fd].open || conns[fd].closing) return;
+        conns[fd].closing = true;
+        closeList.push_back(fd);
+    }
+
+    // fd 를 닫은 뒤 호출 (세대는 유지 -> 같은 번호의 다음 연결이 다른 세대를 받음)
+    auto release(int fd) -> void {
+        if (conns[fd].gameId != -1) {
+            auto it = owners.find(seatOf(conns[fd].gameId, conns[fd].playerId));
+            if (it != owners.end() && it->second == fd) owners.erase(it);
+        }
+        uint32_t gen = conns[fd].gen;
+        conns[fd] = Conn{};
+        conns[fd].gen = gen;
+        --live;
+    }
+
+    template <typename F>
+    auto forEachOpen(F f) -> void {
+        for (size_t fd = 0; fd < conns.size(); ++fd) {
+            if (conns[fd].open) f((int)fd);
+        }
+    }
+
+    // 레코드 하나 처리, false -> 연결 종료 요청
+    auto handle(int fd, const MoveRecord& rec) -> bool {
+        Conn& c = conns[fd];
+        if (rec.version != MOVE_PROTO_VERSION) {
+            logPrint(LogLevel::Warn, "[  Socket   ] 지원하지 않는 프로토콜 버전 v%u", (unsigned)rec.version);
+            return true;
+        }
+        if (rec.type == REC_DISCONNECT) return false;
+        if (rec.type == REC_CONNECT) {
+            GameLogic* target = games.logic((int)rec.game_id);
+            bool seat = target != nullptr && rec.player_id >= 1 && rec.player_id <= target->getState().getPlayers();
+            bool taken = false;
+            if (seat && c.gameId == -1) {
+                auto it = owners.find(seatOf((int)rec.game_id, rec.player_id));
+                taken = it != owners.end() && active(it->second) != nullptr;
+            }
+            if (!seat || c.gameId != -1 || taken) {
+                logPrint(LogLevel::Warn, "[  Session  ] 연결 거절 C%d ( G%u P%u%s )", fd, rec.game_id, (unsigned)rec.player_id,
+                         c.gameId != -1 ? " : 이미 자리에 묶인 연결" : taken ? " : 이미 연결된 자리" : "");
+                queueReply(fd, REPLY_REJECTED, rec.seq, 0, 0);
+                return true;
+            }
+            c.gameId = (int)rec.game_id;
+            c.playerId = rec.player_id;
+            owners[seatOf(c.gameId, c.playerId)] = fd;
+            games.joined(c.gameId);
+            GameState& state = target->getState();
+            queueReply(fd, REPLY_OK, rec.seq, state.getNumber(), state.getTurn());
+            logPrint(LogLevel::Info, "[  Session  ] 연결 C%d ( G%u P%u )", fd, rec.game_id, (unsigned)rec.player_id);
+            return true;
+        }
+        if (rec.type != REC_MOVE) return true;
+
+        // 게임 / 플레이어는 레코드가 아니라 연결에 기록된 값을 사용
+        GameLogic* logic = games.logic(c.gameId);
+        if (logic == nullptr) {
+            queueReply(fd, REPLY_REJECTED, rec.seq, 0, 0);
+            return true;
+        }
+        GameState& state = logic->getState();
+        if (state.isGameOver()) {
+            queueReply(fd, REPLY_GAME_OVER, rec.seq, state.getNumber(), state.getTurn());
+            return true;
+        }
+        char tag[32] = "";
+        if (games.size() > 1) snprintf(tag, sizeof(tag), "[ Game %d ] ", c.gameId);
+        logPrint(LogLevel::Info, "%s[  Socket   ] ( 신호 감지 -> 턴 진행 P%d #%u )", tag, c.playerId, rec.seq);
+        MoveResult r = games.apply(c.gameId, c.playerId, rec.cnt);
+        int16_t status = replyStatusOf(r);
+        queueReply(fd, status, rec.seq, state.getNumber(), state.getTurn());
+        return true;
+    }
+};
+
+// [ OCP ] 소켓 기반 입력 수신 채널 - epoll 백엔드 (이벤트 스레드 하나가 모든 연결을 처리)
+// 한 번의 epoll_wait 으로 깨어난 연결들의 레코드를 모두 처리한 뒤 저널 그룹 커밋, 응답은 연결별로 sendmmsg 한 번
+class SocketReceiver : public IReceiver {
+    GameTable& games;
+    SocketConnTable table;
+    int listenFd;
+    int epFd = -1;
+    int wakeRead;
+    int wakeFd;
+    ServerMetrics& metricsOwner;
+    MetricsSlot* metrics = nullptr;
+    bool acceptWarned = false;
+
+    epoll_event events[SOCK_EVENTS];
+    MoveRecord inbox[SOCK_BATCH];
+    iovec inIov[SOCK_BATCH];
+    mmsghdr inMsgs[SOCK_BATCH];
+    iovec outIov[SOCK_BATCH];
+    mmsghdr outMsgs[SOCK_BATCH];
+
+    // 대기열이 빌 때까지 accept (edge-triggered : 이번에 다 받지 않으면 다음 연결이 올 때까지 이벤트가 없음)
+    auto acceptAll() -> void {
+        while (true) {
+            int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd == -1) {
+                if (errno == EINTR || errno == ECONNABORTED) continue;
+                if ((errno == EMFILE || errno == ENFILE) && !acceptWarned) {
+                    logPrint(LogLevel::Warn, "[  Socket   ] fd 한도 도달 ( 연결 %d ) -> 새 연결 보류", table.connections());
+                    acceptWarned = true;
+                }
+                return;
+            }
+            epoll_event ev{};
+            ev.events = EPOLLIN | EPOLLRDHUP | EPOLLET;
+            ev.data.fd = fd;
+            if (epoll_ctl(epFd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+                ::close(fd);
+                continue;
+            }
+            table.add(fd);
+        }
+    }
+
+    // 연결 하나를 EAGAIN 까지 읽어 처리, false -> 연결 종료 (EOF / 오류 / DISCONNECT)
+    // recvmmsg 가 SOCK_BATCH 보다 적게 돌려주면 비운 것으로 봄 (그 뒤 도착한 메시지는 새 edge 로 다시 알림)
+    auto drain(int fd) -> bool {
+        while (true) {
+            int n = recvmmsg(fd, inMsgs, SOCK_BATCH, MSG_DONTWAIT, nullptr);
+            metrics->add(M_SYSCALLS);
+            if (n == -1) {
+                if (errno == EINTR) continue;
+                return errno == EAGAIN || errno == EWOULDBLOCK;
+            }
+            if (n == 0) return false;
+            metrics->add(M_RECORDS_READ, (uint64_t)n);
+            metrics->record(H_BATCH, (uint64_t)n);
+            for (int i = 0; i < n; ++i) {
+                if (inMsgs[i].msg_len == 0) return false; // 상대가 닫음
+                if (inMsgs[i].msg_len != sizeof(MoveRecord)) continue;
+                if (!table.handle(fd, inbox[i])) return false;
+            }
+            if (n < SOCK_BATCH) return true;
+        }
+    }
+
+    // 연결별로 모인 응답을 sendmmsg 한 번에 (클라이언트가 읽지 않아 버퍼가 가득 차면 버림)
+    auto flushReplies() -> void {
+        auto& replies = table.replies;
+        size_t i = 0;
+        while (i < replies.size()) {
+            int fd = replies[i].fd;
+            int k = 0;
+            while (i + k < replies.size() && replies[i + k].fd == fd && k < SOCK_BATCH) {
+                outIov[k].iov_base = &replies[i + k].rec;
+                outIov[k].iov_len = sizeof(ReplyRecord);
+                ++k;
+            }
+            if (table.active(fd) != nullptr) {
+                (void)!sendmmsg(fd, outMsgs, (unsigned)k, MSG_DONTWAIT | MSG_NOSIGNAL);
+                metrics->add(M_SYSCALLS);
+            }
+            i += k;
+        }
+        replies.clear();
+    }
+public:
+    SocketReceiver(ServerContext& ctx, int listen, int wakeR, int wakeW)
+        : games{ctx.games}, table{ctx.games}, listenFd{listen}, wakeRead{wakeR}, wakeFd{wakeW}, metricsOwner{ctx.metrics} {
+        for (int i = 0; i < SOCK_BATCH; ++i) {
+            inIov[i] = iovec{&inbox[i], sizeof(MoveRecord)};
+            inMsgs[i] = mmsghdr{};
+            inMsgs[i].msg_hdr.msg_iov = &inIov[i];
+            inMsgs[i].msg_hdr.msg_iovlen = 1;
+            outMsgs[i] = mmsghdr{};
+            outMsgs[i].msg_hdr.msg_iov = &outIov[i];
+            outMsgs[i].msg_hdr.msg_iovlen = 1;
+        }
+        epFd = epoll_create1(EPOLL_CLOEXEC);
+        if (epFd == -1) { perror("epoll_create1"); return; }
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLET;
+        ev.data.fd = listenFd;
+        epoll_ctl(epFd, EPOLL_CTL_ADD, listenFd, &ev);
+        ev.events = EPOLLIN; // 깨우기 pipe 는 level-triggered (비우지 않아도 정지 확인까지 계속 깨어 있음)
+        ev.data.fd = wakeRead;
+        epoll_ctl(epFd, EPOLL_CTL_ADD, wakeRead, &ev);
+    }
+
+    auto valid() -> bool { return epFd != -1; }
+
+    auto poll(const StopToken& stop, uint64_t waitNs) -> TaskStep override {
+        if (metrics == nullptr) metrics = &metricsOwner.claim("socket");
+        threadMetrics() = metrics;
+        while (!stop.stopRequested() && games.unfinished() > 0) {
+            int timeoutMs = waitNs > 0 ? (int)((waitNs + 999999) / 1000000) : -1;
+            uint64_t waitStart = metricsNowNs();
+            int n = epoll_wait(epFd, events, SOCK_EVENTS, timeoutMs);
+            metrics->add(M_WAKEUPS);
+            metrics->add(M_SYSCALLS);
+            metrics->record(H_WAIT_NS, metricsNowNs() - waitStart);
+            if (n == -1) {
+                if (errno == EINTR) continue;
+                perror("epoll_wait ( socket )");
+                return TaskStep::Done;
+            }
+            if (n == 0 && waitNs > 0) return TaskStep::Yield;
+
+            for (int i = 0; i < n; ++i) {
+                int fd = events[i].data.fd;
+                if (fd == listenFd) { acceptAll(); continue; }
+                if (fd == wakeRead) continue; // 루프 조건에서 정지 확인
+                if (table.active(fd) == nullptr) continue;
+                uint32_t ev = events[i].events;
+                bool keep = (ev & EPOLLIN) ? drain(fd) : true;
+                if (!keep || (ev & (EPOLLHUP | EPOLLERR)) || ((ev & EPOLLRDHUP) && !(ev & EPOLLIN))) table.markClosing(fd);
+            }
+
+            // 그룹 커밋 뒤 응답 전송, 그 다음에 닫기
+            games.commitJournal();
+            flushReplies();
+            for (int fd : table.closeList) {
+                ::close(fd); // epoll 등록도 함께 해제
+                table.release(fd);
+            }
+            if (!table.closeList.empty()) acceptWarned = false;
+            table.closeList.clear();
+            if (waitNs > 0) return TaskStep::Yield;
+        }
+        return TaskStep::Done;
+    }
+
+    void wake() override {
+        char c = 1;
+        (void)!write(wakeFd, &c, 1);
+    }
+
+    ~SocketReceiver() {
+        table.forEachOpen([](int fd) { ::close(fd); });
+        if (epFd != -1) ::close(epFd);
+    }
+};
+
+// [ OCP ] 소켓 기반 입력 수신 채널 - io_uring 백엔드
+// 리슨 소켓에 멀티샷 accept, 연결마다 멀티샷 recv (제공 버퍼 링에서 버퍼 선택) 를 한 번 걸어 두면 커널이 완료를 계속 쌓음
+// 루프 한 번 = io_uring_enter 한 번 : 직전 처리의 응답 send / 새 연결의 recv 제출 + 다음 완료 대기
+// 응답 여러 개가 같은 연결로 가면 IOSQE_IO_LINK 로 순서 유지
+class UringSocketReceiver : public IReceiver {
+    enum : uint8_t { K_ACCEPT = 1, K_RECV = 2, K_SEND = 3, K_WAKE = 4 };
+
+    GameTable& games;
+    SocketConnTable table;
+    int listenFd;
+    int wakeRead;
+    int wakeFd;
+    ServerMetrics& metricsOwner;
+    MetricsSlot* metrics = nullptr;
+    UringBufRing bufs; // ring 보다 먼저 선언 -> ring 을 먼저 닫은 뒤 버퍼 해제
+    UringQueue ring;
+    bool ready = false;
+    bool acceptArmed = false;
+    bool wakeArmed = false;
+    bool acceptWarned = false;
+    uint64_t entersSeen = 0;
+
+    std::deque<ReplyRecord> sendPool; // send 완료 전까지 커널이 읽는 응답 (deque -> 늘어나도 주소 유지)
+    vector<uint32_t> freeSends;
+    vector<int> rearm;                // 버퍼가 모자라 멀티샷 recv 가 끝난 연결 (버퍼를 돌려준 뒤 다시 걸기)
+
+    auto armRecv(int fd, uint32_t gen) -> void { uringPrepRecvMulti(ring.sqe(), fd, bufs, uringTag(K_RECV, (uint32_t)fd, gen)); }
+
+    auto onAccept(const io_uring_cqe& cqe) -> void {
+        if (!(cqe.flags & IORING_CQE_F_MORE)) acceptArmed = false;
+        if (cqe.res < 0) {
+            if ((cqe.res == -EMFILE || cqe.res == -ENFILE) && !acceptWarned) {
+                logPrint(LogLevel::Warn, "[  Socket   ] fd 한도 도달 ( 연결 %d ) -> 새 연결 보류", table.connections());
+                acceptWarned = true;
+            }
+            return;
+        }
+        armRecv(cqe.res, table.add(cqe.res).gen);
+    }
+
+    auto onRecv(const io_uring_cqe& cqe, uint64_t& records) -> void {
+        int fd = (int)uringTagIndex(cqe.user_data);
+        SocketConnTable::Conn* c = table.active(fd, uringTagGen(cqe.user_data));
+        if (cqe.flags & IORING_CQE_F_BUFFER) {
+            uint16_t bid = (uint16_t)(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+            if (c != nullptr && cqe.res == (int)sizeof(MoveRecord)) {
+                MoveRecord rec;
+                memcpy(&rec, bufs.buffer(bid), sizeof(rec));
+                ++records;
+                if (!table.handle(fd, rec)) table.markClosing(fd);
+            }
+            bufs.put(bid);
+        }
+        if (c == nullptr || c->closing || (cqe.flags & IORING_CQE_F_MORE)) return;
+        // 멀티샷 종료 : 버퍼 부족이면 다시 걸고, EOF(0) / 오류면 닫음
+        if (cqe.res == -ENOBUFS || cqe.res > 0) rearm.push_back(fd);
+        else table.markClosing(fd);
+    }
+
+    // 처리한 응답을 send SQE 로 (제출은 다음 io_uring_enter 에서)
+    auto queueSends() -> void {
+        auto& replies = table.replies;
+        for (size_t i = 0; i < replies.size(); ++i) {
+            int fd = replies[i].fd;
+            if (table.active(fd) == nullptr) continue;
+            uint32_t slot;
+            if (!freeSends.empty()) {
+                slot = freeSends.back();
+                freeSends.pop_back();
+                sendPool[slot] = replies[i].rec;
+            } else {
+                slot = (uint32_t)sendPool.size();
+                sendPool.push_back(replies[i].rec);
+            }
+            io_uring_sqe* s = ring.sqe();
+            uringPrepSend(s, fd, &sendPool[slot], sizeof(ReplyRecord), uringTag(K_SEND, slot));
+            if (i + 1 < replies.size() && replies[i + 1].fd == fd) s->flags |= IOSQE_IO_LINK;
+        }
+        replies.clear();
+    }
+
+    auto countSyscalls() -> void {
+        metrics->add(M_SYSCALLS, ring.enterCount() - entersSeen);
+        entersSeen = ring.enterCount();
+    }
+public:
+    UringSocketReceiver(ServerContext& ctx, int listen, int wakeR, int wakeW)
+        : games{ctx.games}, table{ctx.games}, listenFd{listen}, wakeRead{wakeR}, wakeFd{wakeW}, metricsOwner{ctx.metrics} {
+        ready = ring.open(SOCK_URING_SQ, SOCK_URING_CQ) && bufs.open(ring, 0, SOCK_URING_BUFS, 32);
+    }
+
+    auto valid() -> bool { return ready; }
+
+    auto poll(const StopToken& stop, uint64_t waitNs) -> TaskStep override {
+        if (metrics == nullptr) metrics = &metricsOwner.claim("socket uring");
+        threadMetrics() = metrics;
+        while (!stop.stopRequested() && games.unfinished() > 0) {
+            if (!acceptArmed) {
+                uringPrepAcceptMulti(ring.sqe(), listenFd, uringTag(K_ACCEPT, 0));
+                acceptArmed = true;
+            }
+            if (!wakeArmed) {
+                uringPrepPollMulti(ring.sqe(), wakeRead, uringTag(K_WAKE, 0));
+                wakeArmed = true;
+            }
+            uint64_t waitStart = metricsNowNs();
+            int r = ring.submit(1, waitNs);
+            metrics->add(M_WAKEUPS);
+            metrics->record(H_WAIT_NS, metricsNowNs() - waitStart);
+            if (r < 0 && r != -ETIME && r != -EINTR) {
+                errno = -r;
+                perror("io_uring_enter ( socket )");
+                return TaskStep::Done;
+            }
+
+            uint64_t records = 0;
+            ring.drain([&](const io_uring_cqe& cqe) {
+                switch (uringTagKind(cqe.user_data)) {
+                case K_ACCEPT: onAccept(cqe); break;
+                case K_RECV: onRecv(cqe, records); break;
+                case K_SEND: freeSends.push_back(uringTagIndex(cqe.user_data)); break;
+                case K_WAKE: {
+                    char drainBuf[64];
+                    while (read(wakeRead, drainBuf, sizeof(drainBuf)) > 0) {}
+                    if (!(cqe.flags & IORING_CQE_F_MORE)) wakeArmed = false;
+                    break;
+                }
+                }
+            });
+            bufs.publish();
+            for (int fd : rearm) {
+                if (SocketConnTable::Conn* c = table.active(fd)) armRecv(fd, c->gen);
+            }
+            rearm.clear();
+            if (records > 0) {
+                metrics->add(M_RECORDS_READ, records);
+                metrics->record(H_BATCH, records);
+            }
+
+            // 그룹 커밋 뒤 응답 제출, 닫는 연결은 응답을 보내지 않으므로 바로 닫음
+            // (shutdown -> 걸려 있는 멀티샷 recv 가 0 으로 끝나 커널이 잡고 있던 소켓 참조도 놓음)
+            games.commitJournal();
+            queueSends();
+            for (int fd : table.closeList) {
+                shutdown(fd, SHUT_RDWR);
+                ::close(fd);
+                table.release(fd);
+            }
+            if (!table.closeList.empty()) acceptWarned = false;
+            table.closeList.clear();
+
+            if (waitNs > 0) {
+                if (ring.pending() > 0) ring.submit(0, 0); // 양보하는 동안 응답이 묶여 있지 않게
+                countSyscalls();
+                return TaskStep::Yield;
+            }
+            countSyscalls();
+        }
+        if (ring.pending() > 0) ring.submit(0, 0); // 마지막 처리의 응답 (게임 종료 응답 포함)
+        countSyscalls();
+        return TaskStep::Done;
+    }
+
+    void wake() override {
+        char c = 1;
+        (void)!write(wakeFd, &c, 1);
+    }
+
+    ~UringSocketReceiver() {
+        table.forEachOpen([](int fd) { ::close(fd); });
+    }
+};
+
+// [ SRP ] 리슨 소켓 / 깨우기 pipe 수명 관리, ctx.io 에 따라 수신기 백엔드 선택
+class SocketTransport : public ITransport {
+    int listenFd = -1;
+    int wakePipe[2] = {-1, -1};
+    std::unique_ptr<IReceiver> receiver;
+
+    // 연결마다 fd 하나 -> soft 한도를 hard 한도까지 올림
+    static auto raiseFdLimit() -> rlim_t {
+        rlimit rl{};
+        if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < rl.rlim_max) {
+            rl.rlim_cur = rl.rlim_max;
+            setrlimit(RLIMIT_NOFILE, &rl);
+        }
+        getrlimit(RLIMIT_NOFILE, &rl);
+        return rl.rlim_cur;
+    }
+public:
+    auto open(ServerContext& ctx) -> bool override {
+        rlim_t fdLimit = raiseFdLimit();
+        listenFd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listenFd == -1) { perror("socket"); return false; }
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", SOCK_PATH);
+        unlink(SOCK_PATH); // 이전 실행이 남긴 소켓 파일
+        if (bind(listenFd, (sockaddr*)&addr, sizeof(addr)) == -1) { perror("bind ( socket )"); return false; }
+        if (listen(listenFd, SOCK_BACKLOG) == -1) { perror("listen"); return false; }
+        if (pipe2(wakePipe, O_NONBLOCK | O_CLOEXEC) == -1) { perror("pipe2"); return false; }
+
+        bool uring = ctx.io == IoBackend::Uring;
+        if (uring) {
+            UringSocketReceiver* r = new UringSocketReceiver(ctx, listenFd, wakePipe[0], wakePipe[1]);
+            receiver.reset(r);
+            if (!r->valid()) { logPrint(LogLevel::Error, "[ Transport ] socket : io_uring 준비 실패"); return false; }
+        } else {
+            SocketReceiver* r = new SocketReceiver(ctx, listenFd, wakePipe[0], wakePipe[1]);
+            receiver.reset(r);
+            if (!r->valid()) return false;
+        }
+        logPrint(LogLevel::Info, "[ Transport ] socket : %s ( SOCK_SEQPACKET, %s, fd 한도 %llu )", SOCK_PATH,
+                 uring ? "io_uring" : "epoll", (unsigned long long)fdLimit);
+        return true;
+    }
+
+    auto receivers() -> std::vector<IReceiver*> override { return {receiver.get()}; }
+
+    // 연결은 서버 프로세스와 함께 끊기므로 preserve 여부와 관계없이 소켓 파일 삭제 (재시작한 서버가 다시 bind)
+    auto close(bool) -> void override {
+        receiver.reset();
+        for (int fd : {listenFd, wakePipe[0], wakePipe[1]}) {
+            if (fd != -1) ::close(fd);
+        }
+        listenFd = wakePipe[0] = wakePipe[1] = -1;
+        unlink(SOCK_PATH);
+    }
+};
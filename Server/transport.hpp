@@ -0,0 +1,40 @@
+#pragma once // br31_server 전송 계층 인터페이스 : 전송 하나 = IPC 자원 준비 + 수신기 + 정리
+
+#include "../Pipe/headerSet.hpp"
+#include "../Pipe/gameTable.hpp"
+#include "../Common/receiver.hpp"
+#include "../Common/serverMetrics.hpp"
+#include <memory>
+
+// 수신기 I/O 백엔드 (--io), 전송마다 지원하는 쪽을 고름 (링 전송은 공유 메모리라 해당 없음)
+enum class IoBackend {
+    Epoll, // 준비 통지 + read / recvmmsg / sendmmsg
+    Uring  // io_uring 멀티샷 수신 + 제공 버퍼 링, 제출 / 완료를 io_uring_enter 한 번에
+};
+
+// 전송이 공유하는 서버 상태 (게임 엔진 하나를 모든 전송이 함께 사용)
+struct ServerContext {
+    GameTable& games;
+    SharedTable* shared;
+    bool reattached;     // --recover 로 이전 서버의 게임 세그먼트에 재부착
+    bool deferReplies;   // durable 저널 -> 응답을 그룹 커밋 뒤로 미룸
+    int ringGame;        // 공유 메모리 링 전송이 맡는 게임 id
+    ServerMetrics& metrics;
+    IoBackend io;        // 실행 중인 커널이 io_uring 을 지원하지 않으면 br31_server 가 Epoll 로 바꿔서 넘김
+};
+
+// [ OCP : 개방 폐쇄 원칙 ] 새 전송 = ITransport 구현 하나 + br31_server.cpp 의 TRANSPORTS 한 줄
+// [ SRP : 단일 책임 원칙 ] 전송별 IPC 자원 수명만 관리, 이동 반영은 GameTable::apply 에 위임
+class ITransport {
+public:
+    virtual auto open(ServerContext& ctx) -> bool = 0;       // IPC 자원 준비 (실패하면 false, 이미 연 자원은 close 가 정리)
+    virtual auto receivers() -> std::vector<IReceiver*> = 0; // executor 에 등록할 수신기
+    virtual auto close(bool preserve) -> void = 0;           // preserve : --recover 종료 -> 클라이언트가 붙어 있는 자원 유지
+    virtual ~ITransport() = default;
+};
+
+struct TransportEntry {
+    const char* name;    // --transport 에 쓰는 이름
+    const char* summary; // 사용법 출력용 한 줄 설명
+    std::unique_ptr<ITransport> (*make)();
+};
@@ -0,0 +1,214 @@
+#include "../Pipe/gameCore.hpp"
+#include "../Common/strategyTable.hpp"
+#include "../Common/workStealingPool.hpp"
+#include "../Common/benchStats.hpp"
+#include <deque>
+#include <memory>
+
+// [ SRP ] 인프로세스 자가 대국 시뮬레이터
+// 서버와 같은 GameState 규칙(commitMove : 턴 검증 / 숫자 반영 / 종료 판단 / 턴 교대)을 공유 메모리 대신
+// 일반 메모리의 SharedData 위에서 실행, 게임 N판을 work-stealing 풀로 모든 코어에 나눠 진행
+// 게임별 난수 시드 = (전체 시드, 게임 번호) -> 스레드 수와 관계없이 같은 결과
+
+using Bot = StrategyTable<MAX_NUM, MAX_PER_TURN>;
+
+// splitmix64 : 시드 섞기 + 난수 한 단계 (상태 64비트, 할당 없음)
+inline auto nextRandom(uint64_t& state) -> uint64_t {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// IStrategy (추상 클래스 / 인터페이스)
+// [ OCP ] 새 전략은 클래스 하나 추가 후 makeStrategy 에 이름만 등록
+class IStrategy {
+public:
+    virtual auto name() const -> string = 0;
+    virtual auto choose(int number, uint64_t& rng) const -> int = 0; // 이번 턴에 외칠 개수 (1 ~ MAX_PER_TURN)
+    virtual ~IStrategy() = default;
+};
+
+// 컴파일 시간 전략 표 조회 (봇 클라이언트와 동일)
+class OptimalStrategy : public IStrategy {
+public:
+    auto name() const -> string override { return "optimal"; }
+    auto choose(int number, uint64_t&) const -> int override { return Bot::bestMove(number); }
+};
+
+// 1 ~ MAX_PER_TURN 균등 난수
+class RandomStrategy : public IStrategy {
+public:
+    auto name() const -> string override { return "random"; }
+    auto choose(int, uint64_t& rng) const -> int override { return 1 + (int)(nextRandom(rng) % MAX_PER_TURN); }
+};
+
+// 항상 같은 개수 (기존 클라이언트의 고정 2개 외침 = fixed2)
+class FixedStrategy : public IStrategy {
+    int cnt;
+public:
+    explicit FixedStrategy(int c) : cnt{c} {}
+    auto name() const -> string override { return "fixed" + to_string(cnt); }
+    auto choose(int, uint64_t&) const -> int override { return cnt; }
+};
+
+// 이름 -> 전략 (optimal | random | fixed1 ~ fixedN), 모르는 이름이면 nullptr
+auto makeStrategy(const string& name) -> unique_ptr<IStrategy> {
+    if (name == "optimal") return make_unique<OptimalStrategy>();
+    if (name == "random") return make_unique<RandomStrategy>();
+    if (name.rfind("fixed", 0) == 0) {
+        int c = atoi(name.c_str() + 5);
+        if (c >= 1 && c <= MAX_PER_TURN) return make_unique<FixedStrategy>(c);
+    }
+    return nullptr;
+}
+
+struct SimConfig {
+    uint64_t games = 1000000;
+    int threads = 0;            // 0 -> 온라인 코어 수
+    int players = 2;
+    uint64_t seed = 31;
+    uint64_t chunk = 1024;      // 워커가 한 번에 꺼내는 게임 수
+    bool rotate = false;        // 게임마다 선 플레이어를 돌아가며 지정
+    vector<unique_ptr<IStrategy>> seats; // seats[p] : 플레이어 p 의 전략 (1-based)
+};
+
+// 워커별 집계 (캐시 라인 분리, 끝난 뒤 한 번만 합침)
+struct alignas(64) SimStats {
+    uint64_t games = 0;
+    uint64_t turns = 0;
+    uint64_t aborted = 0;                 // 규칙 위반으로 중단된 게임 (전략 버그)
+    uint64_t losses[MAX_PLAYERS + 1] = {}; // 플레이어별 패배 (MAX_NUM 을 외친 횟수)
+    uint64_t lengths[MAX_NUM + 1] = {};   // 게임 길이(턴 수) 분포, 한 턴에 최소 1개라 MAX_NUM 이하
+
+    auto merge(const SimStats& o) -> void {
+        games += o.games;
+        turns += o.turns;
+        aborted += o.aborted;
+        for (int i = 0; i <= MAX_PLAYERS; ++i) losses[i] += o.losses[i];
+        for (int i = 0; i <= MAX_NUM; ++i) lengths[i] += o.lengths[i];
+    }
+
+    // p : 0 ~ 100, 게임 길이 백분위
+    auto lengthPercentile(double p) const -> int {
+        uint64_t rank = (uint64_t)(p / 100.0 * (double)games + 0.5), seen = 0;
+        if (rank < 1) rank = 1;
+        for (int i = 0; i <= MAX_NUM; ++i) {
+            seen += lengths[i];
+            if (seen >= rank) return i;
+        }
+        return MAX_NUM;
+    }
+};
+
+// 워커 하나가 쓰는 게임 슬롯 (일반 메모리 SharedData + 그 위의 GameState)
+struct alignas(64) SimLane {
+    SharedData data{};
+};
+
+// 게임 한 판 진행 (GameState 는 워커가 재사용, start 로 초기화)
+static auto playGame(GameState& state, const SimConfig& cfg, uint64_t gameIndex, SimStats& st) -> void {
+    uint64_t rng = cfg.seed ^ (gameIndex * 0xD1B54A32D192ED03ULL);
+    nextRandom(rng);
+    int first = cfg.rotate ? (int)(gameIndex % (uint64_t)cfg.players) + 1 : 1;
+    state.start(cfg.players, first);
+
+    int turns = 0, from = 0;
+    while (true) {
+        int player = state.getTurn();
+        int cnt = cfg.seats[player]->choose(state.getNumber(), rng);
+        MoveResult r = state.commitMove(player, cnt, from);
+        ++turns;
+        if (r == MoveResult::Finished) {
+            st.losses[player]++;
+            break;
+        }
+        if (r != MoveResult::Applied || turns > MAX_NUM) {
+            st.aborted++;
+            break;
+        }
+    }
+    st.games++;
+    st.turns += turns;
+    st.lengths[min(turns, MAX_NUM)]++;
+}
+
+static void printUsage(const char* prog) {
+    cerr << "usage: " << prog << " [-n games] [-t threads] [-p players] [-s strategy[,strategy...]]"
+         << " [--seed N] [--chunk N] [--rotate]" << endl;
+    cerr << "       strategy : optimal | random | fixed1 ~ fixed" << MAX_PER_TURN
+         << " (플레이어 순서대로 지정, 모자라면 마지막 전략 반복)" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    ios::sync_with_stdio(false);
+    cin.tie(nullptr);
+    cout.tie(nullptr);
+
+    SimConfig cfg;
+    string strategies = "optimal,random";
+    for (int i = 1; i < argc; ++i) {
+        bool hasNext = i + 1 < argc;
+        if (strcmp(argv[i], "-n") == 0 && hasNext) cfg.games = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "-t") == 0 && hasNext) cfg.threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-p") == 0 && hasNext) cfg.players = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-s") == 0 && hasNext) strategies = argv[++i];
+        else if (strcmp(argv[i], "--seed") == 0 && hasNext) cfg.seed = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--chunk") == 0 && hasNext) cfg.chunk = strtoull(argv[++i], nullptr, 10);
+        else if (strcmp(argv[i], "--rotate") == 0) cfg.rotate = true;
+        else { printUsage(argv[0]); return 1; }
+    }
+    if (cfg.games == 0 || cfg.games > 0xFFFFFFFFULL || cfg.players < 2 || cfg.players > MAX_PLAYERS) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // 전략 목록 -> 좌석 배정
+    vector<string> names;
+    size_t pos = 0;
+    while (true) {
+        size_t comma = strategies.find(',', pos);
+        names.push_back(strategies.substr(pos, comma == string::npos ? string::npos : comma - pos));
+        if (comma == string::npos) break;
+        pos = comma + 1;
+    }
+    cfg.seats.resize(cfg.players + 1);
+    for (int p = 1; p <= cfg.players; ++p) {
+        const string& n = names[min((size_t)p - 1, names.size() - 1)];
+        cfg.seats[p] = makeStrategy(n);
+        if (cfg.seats[p] == nullptr) {
+            cerr << "unknown strategy : " << n << endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    WorkStealingPool pool(cfg.threads);
+    vector<SimLane> lanes(pool.size());
+    deque<GameState> states;
+    for (auto& lane : lanes) states.emplace_back(&lane.data);
+    vector<SimStats> stats(pool.size());
+
+    uint64_t start = benchNowNs();
+    pool.run(cfg.games, cfg.chunk, [&](int worker, uint64_t begin, uint64_t end) {
+        GameState& state = states[worker];
+        SimStats& st = stats[worker];
+        for (uint64_t g = begin; g < end; ++g) playGame(state, cfg, g, st);
+    });
+    double seconds = (benchNowNs() - start) / 1e9;
+
+    SimStats total;
+    for (auto& s : stats) total.merge(s);
+
+    printf("[ Sim ] games=%llu players=%d threads=%d elapsed=%.3fs games/s=%.0f%s\n", (unsigned long long)total.games,
+           cfg.players, pool.size(), seconds, seconds > 0 ? total.games / seconds : 0.0, cfg.rotate ? " (선 순환)" : "");
+    for (int p = 1; p <= cfg.players; ++p) {
+        double lossRate = 100.0 * total.losses[p] / total.games;
+        printf("        P%-2d %-8s 패배 %10llu ( %6.2f%% )  생존 %6.2f%%\n", p, cfg.seats[p]->name().c_str(),
+               (unsigned long long)total.losses[p], lossRate, 100.0 - lossRate);
+    }
+    printf("        게임 길이(턴) mean=%.2f min=%d p50=%d p99=%d max=%d\n", (double)total.turns / total.games,
+           total.lengthPercentile(0), total.lengthPercentile(50), total.lengthPercentile(99), total.lengthPercentile(100));
+    if (total.aborted > 0) printf("        규칙 위반으로 중단된 게임 %llu\n", (unsigned long long)total.aborted);
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include "../Common/serverMetrics.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+// [ SRP ] 서버 메트릭 조회 도구 (vmstat 형식)
+// 서버가 만든 메트릭 세그먼트에 읽기 전용으로 붙어 interval 마다 카운터 / 히스토그램 차이를 한 줄씩 출력
+// 첫 줄은 서버 시작 이후 평균, 서버가 재시작하면(세그먼트 id 변경) 다시 붙고, 세그먼트가 사라지면 종료
+
+struct StatSnapshot {
+    uint64_t counters[M_COUNTERS] = {};
+    uint64_t hist[M_HISTOGRAMS][METRICS_HIST_BUCKETS] = {};
+};
+
+// 사용 중인 슬롯 전체(또는 slot 하나) 합계
+static auto takeSnapshot(const MetricsBlock* block, int slot, StatSnapshot& out) -> void {
+    out = StatSnapshot{};
+    uint32_t used = block->slots_used.load(memory_order_relaxed);
+    if (used > METRICS_MAX_THREADS) used = METRICS_MAX_THREADS;
+    for (uint32_t i = 0; i < used; ++i) {
+        if (slot >= 0 && (int)i != slot) continue;
+        const MetricsSlot& s = block->slots[i];
+        if (s.in_use.load(memory_order_acquire) == 0) continue;
+        for (int c = 0; c < M_COUNTERS; ++c) out.counters[c] += s.counters[c].load(memory_order_relaxed);
+        for (int h = 0; h < M_HISTOGRAMS; ++h) {
+            for (int b = 0; b < METRICS_HIST_BUCKETS; ++b) out.hist[h][b] += s.hist[h][b].load(memory_order_relaxed);
+        }
+    }
+}
+
+// 버킷 차이에서 백분위 (버킷 상한 2^(i+1) 로 근사), 표본이 없으면 0
+static auto percentile(const StatSnapshot& now, const StatSnapshot& prev, MetricHistogram h, double p) -> uint64_t {
+    uint64_t total = 0;
+    for (int b = 0; b < METRICS_HIST_BUCKETS; ++b) total += now.hist[h][b] - prev.hist[h][b];
+    if (total == 0) return 0;
+    uint64_t rank = (uint64_t)(p / 100.0 * (double)total + 0.5), seen = 0;
+    if (rank < 1) rank = 1;
+    for (int b = 0; b < METRICS_HIST_BUCKETS; ++b) {
+        seen += now.hist[h][b] - prev.hist[h][b];
+        if (seen >= rank) return b >= 63 ? UINT64_MAX : (2ULL << b);
+    }
+    return 0;
+}
+
+// ns -> "850ns" / "12.3us" / "4.5ms" / "1.2s"
+static auto formatNs(uint64_t ns) -> string {
+    char buf[16];
+    if (ns < 1000) snprintf(buf, sizeof(buf), "%lluns", (unsigned long long)ns);
+    else if (ns < 1000000) snprintf(buf, sizeof(buf), "%.1fus", ns / 1e3);
+    else if (ns < 1000000000) snprintf(buf, sizeof(buf), "%.1fms", ns / 1e6);
+    else snprintf(buf, sizeof(buf), "%.1fs", ns / 1e9);
+    return buf;
+}
+
+static auto printHeader() -> void {
+    printf("%10s %9s %8s %9s %8s %8s %8s %9s %9s %9s %9s\n", "moves/s", "wrong/s", "fin/s", "wake/s", "rec/wake",
+           "sys/move", "batch99", "wait50", "wait99", "apply50", "apply99");
+}
+
+static auto printRow(const StatSnapshot& now, const StatSnapshot& prev, double seconds) -> void {
+    auto rate = [&](MetricCounter c) { return seconds > 0 ? (now.counters[c] - prev.counters[c]) / seconds : 0.0; };
+    uint64_t wakeups = now.counters[M_WAKEUPS] - prev.counters[M_WAKEUPS];
+    uint64_t records = now.counters[M_RECORDS_READ] - prev.counters[M_RECORDS_READ];
+    uint64_t moves = now.counters[M_MOVES_APPLIED] - prev.counters[M_MOVES_APPLIED];
+    uint64_t syscalls = now.counters[M_SYSCALLS] - prev.counters[M_SYSCALLS];
+    char perMove[16] = "-"; // 시스템 콜을 세지 않는 수신 경로(sem / ring)는 표시 안 함
+    if (syscalls > 0 && moves > 0) snprintf(perMove, sizeof(perMove), "%.2f", (double)syscalls / moves);
+    printf("%10.0f %9.0f %8.0f %9.0f %8.2f %8s %8llu %9s %9s %9s %9s\n", rate(M_MOVES_APPLIED), rate(M_WRONG_TURN),
+           rate(M_GAMES_FINISHED), rate(M_WAKEUPS), wakeups > 0 ? (double)records / wakeups : 0.0, perMove,
+           (unsigned long long)percentile(now, prev, H_BATCH, 99), formatNs(percentile(now, prev, H_WAIT_NS, 50)).c_str(),
+           formatNs(percentile(now, prev, H_WAIT_NS, 99)).c_str(), formatNs(percentile(now, prev, H_APPLY_NS, 50)).c_str(),
+           formatNs(percentile(now, prev, H_APPLY_NS, 99)).c_str());
+}
+
+// -v : 슬롯별 누적 값
+static auto printSlots(const MetricsBlock* block) -> void {
+    uint32_t used = block->slots_used.load(memory_order_relaxed);
+    if (used > METRICS_MAX_THREADS) used = METRICS_MAX_THREADS;
+    StatSnapshot zero;
+    for (uint32_t i = 0; i < used; ++i) {
+        StatSnapshot s;
+        takeSnapshot(block, (int)i, s);
+        printf("    [%2u] %-10s moves=%llu wrong=%llu fin=%llu wake=%llu rec=%llu sys=%llu wait99=%s apply99=%s\n", i,
+               block->slots[i].name, (unsigned long long)s.counters[M_MOVES_APPLIED],
+               (unsigned long long)s.counters[M_WRONG_TURN], (unsigned long long)s.counters[M_GAMES_FINISHED],
+               (unsigned long long)s.counters[M_WAKEUPS], (unsigned long long)s.counters[M_RECORDS_READ],
+               (unsigned long long)s.counters[M_SYSCALLS], formatNs(percentile(s, zero, H_WAIT_NS, 99)).c_str(), formatNs(percentile(s, zero, H_APPLY_NS, 99)).c_str());
+    }
+}
+
+// 읽기 전용 부착 + 헤더 검증, 실패하면 nullptr
+static auto attachMetrics(key_t key, int& shmId) -> const MetricsBlock* {
+    shmId = shmget(key, 0, 0);
+    if (shmId == -1) return nullptr;
+    void* p = shmat(shmId, nullptr, SHM_RDONLY);
+    if (p == (void*)-1) return nullptr;
+    const MetricsBlock* block = (const MetricsBlock*)p;
+    const ShmHeader& h = block->header;
+    if (__atomic_load_n(&h.magic, __ATOMIC_ACQUIRE) != SHM_HEADER_MAGIC || h.layout_version != METRICS_LAYOUT ||
+        h.layout_size != sizeof(MetricsBlock)) {
+        fprintf(stderr, "[ Stat ] 메트릭 세그먼트 레이아웃 불일치 ( 버전 %u, 크기 %u )\n", h.layout_version, h.layout_size);
+        shmdt(p);
+        return nullptr;
+    }
+    return block;
+}
+
+static void printUsage(const char* prog) {
+    cerr << "usage: " << prog << " [--instance N] [-t pipe|sem|server] [-k key] [-i interval sec] [-c count] [-v]" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    // --instance N : -t 로 고르는 키를 그 인스턴스 서버의 키로 (-k 는 그대로 원래 키)
+    if (!Instance::configure(argc, argv)) { printUsage(argv[0]); return 1; }
+    key_t key = METRICS_KEY_PIPE;
+    double interval = 1.0;
+    long count = -1; // -1 -> 서버가 끝날 때까지
+    bool verbose = false;
+    for (int i = 1; i < argc; ++i) {
+        bool hasNext = i + 1 < argc;
+        if (strcmp(argv[i], "-t") == 0 && hasNext) {
+            const char* t = argv[++i];
+            if (strcmp(t, "pipe") == 0) key = METRICS_KEY_PIPE;
+            else if (strcmp(t, "sem") == 0) key = METRICS_KEY_SEM;
+            else if (strcmp(t, "server") == 0) key = METRICS_KEY_SERVER;
+            else { printUsage(argv[0]); return 1; }
+        }
+        else if (strcmp(argv[i], "-k") == 0 && hasNext) key = (key_t)strtol(argv[++i], nullptr, 0);
+        else if (strcmp(argv[i], "-i") == 0 && hasNext) interval = atof(argv[++i]);
+        else if (strcmp(argv[i], "-c") == 0 && hasNext) count = atol(argv[++i]);
+        else if (strcmp(argv[i], "-v") == 0) verbose = true;
+        else { printUsage(argv[0]); return 1; }
+    }
+    if (interval <= 0) { printUsage(argv[0]); return 1; }
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    int shmId = -1;
+    const MetricsBlock* block = attachMetrics(key, shmId);
+    if (block == nullptr) {
+        fprintf(stderr, "[ Stat ] 메트릭 세그먼트 없음 ( key %d ) : 서버가 실행 중인지 확인\n", (int)key);
+        return 1;
+    }
+
+    // 첫 줄 : 서버 시작 이후 평균
+    StatSnapshot prev, now;
+    takeSnapshot(block, -1, now);
+    uint64_t last = metricsNowNs();
+    printf("[ Stat ] key %d 세대 %llu pid %d\n", (int)key, (unsigned long long)shmGeneration(block->header),
+           block->header.owner_pid);
+    printHeader();
+    printRow(now, prev, (last - block->started_ns) / 1e9);
+    if (verbose) printSlots(block);
+    prev = now;
+
+    timespec sleepTs{(time_t)interval, (long)((interval - (long)interval) * 1e9)};
+    for (long row = 1, lines = 1; count < 0 || row < count; ++row) {
+        nanosleep(&sleepTs, nullptr);
+
+        // 세그먼트가 사라졌거나(정상 종료) 새 세그먼트로 바뀌었으면(재시작) 다시 부착
+        int curId = shmget(key, 0, 0);
+        if (curId != shmId) {
+            shmdt((const void*)block);
+            if (curId == -1) {
+                printf("[ Stat ] 메트릭 세그먼트 삭제됨 -> 종료\n");
+                return 0;
+            }
+            block = attachMetrics(key, shmId);
+            if (block == nullptr) return 1;
+            printf("[ Stat ] 서버 재시작 감지 ( 세대 %llu pid %d )\n", (unsigned long long)shmGeneration(block->header),
+                   block->header.owner_pid);
+            prev = StatSnapshot{};
+            last = block->started_ns;
+            lines = 0;
+        }
+
+        takeSnapshot(block, -1, now);
+        uint64_t t = metricsNowNs();
+        if (lines++ % 20 == 0) printHeader();
+        printRow(now, prev, (t - last) / 1e9);
+        if (verbose) printSlots(block);
+        prev = now;
+        last = t;
+    }
+    shmdt((const void*)block);
+    return 0;
+}
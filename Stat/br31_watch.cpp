@@ -0,0 +1,229 @@
+#include "../Common/spectatorChannel.hpp"
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// [ SRP ] 관전 도구
+// 서버가 만든 관전 세그먼트(Common/spectatorChannel.hpp)에 붙어 이동 / 턴 교대 / 종료 이벤트를 발행 순서대로 출력
+// 새 이벤트가 없으면 futex 로 잠들었다가 발행 즉시 깨어남 (폴링 없음), 서버가 재시작하면 다시 붙고 세그먼트가 사라지면 종료
+// -s N : 출력 없이 관전자 N 명을 스레드로 띄워 팬아웃 측정 (관전자별 수신 수 / 건너뜀 / 발행 -> 수신 지연)
+
+static constexpr long WAIT_MS = 200; // 대기 한 번의 최대 길이 (세그먼트 삭제 / 재시작 확인 주기)
+
+volatile sig_atomic_t stop_requested = 0;
+
+void handle_stop(int) { stop_requested = 1; }
+
+// ns -> "850ns" / "12.3us" / "4.5ms" / "1.2s"
+static auto formatNs(uint64_t ns) -> string {
+    char buf[16];
+    if (ns < 1000) snprintf(buf, sizeof(buf), "%lluns", (unsigned long long)ns);
+    else if (ns < 1000000) snprintf(buf, sizeof(buf), "%.1fus", ns / 1e3);
+    else if (ns < 1000000000) snprintf(buf, sizeof(buf), "%.1fms", ns / 1e6);
+    else snprintf(buf, sizeof(buf), "%.1fs", ns / 1e9);
+    return buf;
+}
+
+// 부착 + 헤더 검증, 실패하면 nullptr (대기 중인 관전자 수를 기록하므로 읽기 / 쓰기로 부착)
+static auto attachSpectators(key_t key, int& shmId) -> SpectatorSegment* {
+    shmId = shmget(key, 0, 0);
+    if (shmId == -1) return nullptr;
+    void* p = shmat(shmId, nullptr, 0);
+    if (p == (void*)-1) return nullptr;
+    SpectatorSegment* seg = (SpectatorSegment*)p;
+    const ShmHeader& h = seg->header;
+    if (__atomic_load_n(&h.magic, __ATOMIC_ACQUIRE) != SHM_HEADER_MAGIC || h.layout_version != SPECTATOR_LAYOUT ||
+        h.layout_size != sizeof(SpectatorSegment)) {
+        fprintf(stderr, "[ Watch ] 관전 세그먼트 레이아웃 불일치 ( 버전 %u, 크기 %u )\n", h.layout_version, h.layout_size);
+        shmdt(p);
+        return nullptr;
+    }
+    return seg;
+}
+
+static auto printEvent(const SpectatorEvent& ev) -> void {
+    uint64_t lag = spectatorNowNs() - ev.ns;
+    switch (ev.type) {
+    case SPEC_START:
+        printf("[ G%d ] 시작 ( players = %d, number = %d, turn = P%d )\n", ev.game, ev.player, ev.number, ev.turn);
+        break;
+    case SPEC_MOVE:
+        printf("[ G%d ] P%d +%d -> %2d ( 다음 턴 P%d ) %s\n", ev.game, ev.player, ev.cnt, ev.number, ev.turn, formatNs(lag).c_str());
+        break;
+    case SPEC_OVER:
+        if (ev.player > 0) printf("[ G%d ] GAME OVER ( 패배 P%d, number = %d )\n", ev.game, ev.player, ev.number);
+        else printf("[ G%d ] GAME OVER ( 외부 종료, number = %d )\n", ev.game, ev.number);
+        break;
+    default:
+        printf("[ G%d ] 알 수 없는 이벤트 %u\n", ev.game, ev.type);
+    }
+}
+
+// 관전자 한 명의 수신 통계 (지연은 2의 거듭제곱 버킷)
+struct WatchStats {
+    uint64_t events = 0;
+    uint64_t lost = 0;
+    uint64_t lagHist[64] = {};
+
+    auto record(uint64_t lag) -> void {
+        ++events;
+        ++lagHist[lag == 0 ? 0 : 63 - __builtin_clzll(lag)];
+    }
+    auto merge(const WatchStats& o) -> void {
+        events += o.events;
+        lost += o.lost;
+        for (int b = 0; b < 64; ++b) lagHist[b] += o.lagHist[b];
+    }
+    // 버킷 상한 2^(i+1) 로 근사, 표본이 없으면 0
+    auto percentile(double p) const -> uint64_t {
+        uint64_t rank = (uint64_t)(p / 100.0 * (double)events + 0.5), seen = 0;
+        if (rank < 1) rank = 1;
+        for (int b = 0; b < 64; ++b) {
+            seen += lagHist[b];
+            if (seen >= rank) return b >= 63 ? UINT64_MAX : (2ULL << b);
+        }
+        return 0;
+    }
+};
+
+// -s N : 관전자 스레드 N 개가 각자 읽기 위치를 갖고 같은 세그먼트를 읽음 (서버는 관전자 수를 모름)
+static auto runFanout(key_t key, int shmId, SpectatorSegment* seg, int spectators, int gameFilter) -> int {
+    atomic<bool> done{false};
+    vector<WatchStats> stats(spectators);
+    vector<thread> threads;
+    threads.reserve(spectators);
+    uint64_t start = spectatorNowNs();
+    for (int i = 0; i < spectators; ++i) {
+        threads.emplace_back([&, i] {
+            SpectatorReader reader(seg);
+            WatchStats& s = stats[i];
+            SpectatorEvent ev{};
+            while (!done.load(memory_order_acquire)) {
+                uint64_t lost = 0;
+                SpectatorRead r = reader.read(ev, lost);
+                if (r == SpectatorRead::Lapped) s.lost += lost;
+                else if (r == SpectatorRead::Event && (gameFilter < 0 || ev.game == gameFilter)) s.record(spectatorNowNs() - ev.ns);
+                else if (r == SpectatorRead::Empty) {
+                    timespec t{0, WAIT_MS * 1000000};
+                    reader.wait(&t);
+                }
+            }
+        });
+    }
+    printf("[ Watch ] 관전자 %d 명 부착 ( key %d ) : 세그먼트가 삭제되거나 SIGINT 까지 수신\n", spectators, (int)key);
+
+    // 서버가 세그먼트를 지우면 (정상 종료) 남은 이벤트를 읽을 시간을 준 뒤 정지
+    while (!stop_requested && shmget(key, 0, 0) == shmId) usleep(WAIT_MS * 1000);
+    usleep(WAIT_MS * 1000);
+    done.store(true, memory_order_release);
+    seg->wake_word.fetch_add(1, memory_order_seq_cst);
+    futexWake(&seg->wake_word);
+    for (thread& t : threads) t.join();
+    double seconds = (spectatorNowNs() - start) / 1e9;
+
+    WatchStats total;
+    uint64_t minEvents = UINT64_MAX, maxEvents = 0;
+    for (const WatchStats& s : stats) {
+        total.merge(s);
+        minEvents = min(minEvents, s.events);
+        maxEvents = max(maxEvents, s.events);
+    }
+    printf("[ Watch ] 관전자 %d 명 / %.2fs : 관전자별 이벤트 %llu ~ %llu, 건너뜀 %llu, 전달 %.0f/s\n", spectators, seconds,
+           (unsigned long long)minEvents, (unsigned long long)maxEvents, (unsigned long long)total.lost,
+           seconds > 0 ? total.events / seconds : 0.0);
+    printf("[ Watch ] 발행 -> 수신 지연 p50 %s p99 %s p99.9 %s\n", formatNs(total.percentile(50)).c_str(),
+           formatNs(total.percentile(99)).c_str(), formatNs(total.percentile(99.9)).c_str());
+    shmdt(seg);
+    return 0;
+}
+
+static void printUsage(const char* prog) {
+    cerr << "usage: " << prog << " [--instance N] [-t pipe|sem|server] [-k key] [-g game] [-a] [-s spectators]" << endl;
+    cerr << "    -a : 링에 남은 가장 오래된 이벤트부터 (기본은 부착 이후 이벤트만)" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    // --instance N : -t 로 고르는 키를 그 인스턴스 서버의 키로 (-k 는 그대로 원래 키)
+    if (!Instance::configure(argc, argv)) { printUsage(argv[0]); return 1; }
+    key_t key = SPECTATOR_KEY_PIPE;
+    int gameFilter = -1;
+    bool fromStart = false;
+    int spectators = 0;
+    for (int i = 1; i < argc; ++i) {
+        bool hasNext = i + 1 < argc;
+        if (strcmp(argv[i], "-t") == 0 && hasNext) {
+            const char* t = argv[++i];
+            if (strcmp(t, "pipe") == 0) key = SPECTATOR_KEY_PIPE;
+            else if (strcmp(t, "sem") == 0) key = SPECTATOR_KEY_SEM;
+            else if (strcmp(t, "server") == 0) key = SPECTATOR_KEY_SERVER;
+            else { printUsage(argv[0]); return 1; }
+        }
+        else if (strcmp(argv[i], "-k") == 0 && hasNext) key = (key_t)strtol(argv[++i], nullptr, 0);
+        else if (strcmp(argv[i], "-g") == 0 && hasNext) gameFilter = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-a") == 0) fromStart = true;
+        else if (strcmp(argv[i], "-s") == 0 && hasNext) spectators = atoi(argv[++i]);
+        else { printUsage(argv[0]); return 1; }
+    }
+    if (spectators < 0) { printUsage(argv[0]); return 1; }
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    // SA_RESTART 없이 등록 -> futex 대기가 EINTR 로 바로 돌아옴
+    struct sigaction sa{};
+    sa.sa_handler = handle_stop;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGINT, &sa, nullptr);
+    sigaction(SIGTERM, &sa, nullptr);
+
+    int shmId = -1;
+    SpectatorSegment* seg = attachSpectators(key, shmId);
+    if (seg == nullptr) {
+        fprintf(stderr, "[ Watch ] 관전 세그먼트 없음 ( key %d ) : 서버가 실행 중인지 확인\n", (int)key);
+        return 1;
+    }
+    if (spectators > 0) return runFanout(key, shmId, seg, spectators, gameFilter);
+
+    uint64_t generation = shmGeneration(seg->header);
+    printf("[ Watch ] key %d 세대 %llu pid %d\n", (int)key, (unsigned long long)generation, seg->header.owner_pid);
+    SpectatorReader reader(seg, fromStart);
+    SpectatorEvent ev{};
+    while (!stop_requested) {
+        uint64_t lost = 0;
+        SpectatorRead r = reader.read(ev, lost);
+        if (r == SpectatorRead::Event) {
+            if (gameFilter < 0 || ev.game == gameFilter) printEvent(ev);
+            continue;
+        }
+        if (r == SpectatorRead::Lapped) {
+            printf("[ Watch ] 이벤트 %llu 개 건너뜀 ( 링 %d 칸보다 뒤처짐 )\n", (unsigned long long)lost, SPECTATOR_CAPACITY);
+            continue;
+        }
+        timespec t{0, WAIT_MS * 1000000};
+        if (reader.wait(&t)) continue;
+
+        // 세그먼트가 사라졌거나(정상 종료) 새 세그먼트로 바뀌었으면(재시작) 다시 부착
+        int curId = shmget(key, 0, 0);
+        if (curId != shmId) {
+            shmdt(seg);
+            if (curId == -1) {
+                printf("[ Watch ] 관전 세그먼트 삭제됨 -> 종료\n");
+                return 0;
+            }
+            seg = attachSpectators(key, shmId);
+            if (seg == nullptr) return 1;
+        } else if (shmGeneration(seg->header) == generation) {
+            continue;
+        }
+        // 같은 세그먼트를 새 서버가 다시 초기화한 경우도 세대로 감지 -> 새 서버의 첫 이벤트부터
+        generation = shmGeneration(seg->header);
+        printf("[ Watch ] 서버 재시작 감지 ( 세대 %llu pid %d )\n", (unsigned long long)generation, seg->header.owner_pid);
+        reader = SpectatorReader(seg, true);
+    }
+    shmdt(seg);
+    return 0;
+}